@@ -94,6 +94,11 @@
   product(bool, UseMadvPopulateWrite, true, DIAGNOSTIC,                 \
           "Use MADV_POPULATE_WRITE in os::pd_pretouch_memory.")         \
                                                                         \
+  product(bool, UseMadvCollapse, true, DIAGNOSTIC,                      \
+          "Use MADV_COLLAPSE in os::pd_pretouch_memory to form "        \
+          "transparent huge pages right after pretouch instead of "     \
+          "waiting for khugepaged.")                                    \
+                                                                        \
   product(bool, PrintMemoryMapAtExit, false, DIAGNOSTIC,                \
           "Print an annotated memory map at exit")                      \
                                                                         \
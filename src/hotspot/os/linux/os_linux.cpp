@@ -2987,6 +2987,15 @@ void os::pd_commit_memory_or_exit(char* addr, size_t size, bool exec,
   STATIC_ASSERT(MADV_POPULATE_WRITE == MADV_POPULATE_WRITE_value);
 #endif
 
+// Define MADV_COLLAPSE here so we can build HotSpot on old systems.
+#define MADV_COLLAPSE_value 25
+#ifndef MADV_COLLAPSE
+  #define MADV_COLLAPSE MADV_COLLAPSE_value
+#else
+  // Sanity-check our assumed default value if we build with a new enough libc.
+  STATIC_ASSERT(MADV_COLLAPSE == MADV_COLLAPSE_value);
+#endif
+
 // Note that the value for MAP_FIXED_NOREPLACE differs between architectures, but all architectures
 // supported by OpenJDK share the same flag value.
 #define MAP_FIXED_NOREPLACE_value 0x100000
@@ -3029,6 +3038,61 @@ void os::Linux::madvise_transparent_huge_pages(void* addr, size_t bytes) {
   ::madvise(addr, bytes, MADV_HUGEPAGE);
 }
 
+volatile size_t os::Linux::_thp_collapse_requested_bytes = 0;
+volatile size_t os::Linux::_thp_collapse_failed_bytes = 0;
+
+void os::Linux::collapse_transparent_huge_pages(void* addr, size_t bytes) {
+  if (!UseMadvCollapse) {
+    return;
+  }
+  // MADV_COLLAPSE only works on naturally aligned huge page ranges fully
+  // contained in [addr, addr + bytes).
+  const size_t thp_size = HugePages::thp_pagesize();
+  if (thp_size == 0) {
+    return;
+  }
+  char* const start = align_up((char*)addr, thp_size);
+  char* const end = align_down((char*)addr + bytes, thp_size);
+  if (start >= end) {
+    return;
+  }
+  const size_t len = pointer_delta(end, start, sizeof(char));
+  Atomic::add(&_thp_collapse_requested_bytes, len);
+  if (::madvise(start, len, MADV_COLLAPSE) == -1) {
+    // EAGAIN and ENOMEM are transient: the kernel could not allocate a huge
+    // page for some of the range. Those parts stay small until khugepaged
+    // gets to them. The whole range is counted, as madvise does not tell
+    // which parts succeeded.
+    const int err = errno;
+    Atomic::add(&_thp_collapse_failed_bytes, len);
+    log_trace(pagesize)("::madvise(" PTR_FORMAT ", " SIZE_FORMAT ", %d) failed; "
+                        "error='%s' (errno=%d)", p2i(start), len,
+                        MADV_COLLAPSE, os::strerror(err), err);
+  }
+}
+
+size_t os::Linux::thp_collapse_requested_bytes() {
+  return Atomic::load(&_thp_collapse_requested_bytes);
+}
+
+size_t os::Linux::thp_collapse_failed_bytes() {
+  return Atomic::load(&_thp_collapse_failed_bytes);
+}
+
+void os::Linux::log_thp_collapse_statistics(const char* name, size_t requested_before, size_t failed_before) {
+  const size_t requested = thp_collapse_requested_bytes() - requested_before;
+  if (requested == 0) {
+    return;
+  }
+  const size_t failed = thp_collapse_failed_bytes() - failed_before;
+  const size_t collapsed = requested - MIN2(failed, requested);
+  log_debug(pagesize)("%s: Transparent huge page collapse: " SIZE_FORMAT "%s of "
+                      SIZE_FORMAT "%s collapsed (%.1f%%)", name,
+                      byte_size_in_proper_unit(collapsed), proper_unit_for_byte_size(collapsed),
+                      byte_size_in_proper_unit(requested), proper_unit_for_byte_size(requested),
+                      percent_of(collapsed, requested));
+}
+
 void os::pd_realign_memory(char *addr, size_t bytes, size_t alignment_hint) {
   if (Linux::should_madvise_anonymous_thps() && alignment_hint > vm_page_size()) {
     Linux::madvise_transparent_huge_pages(addr, bytes);
@@ -3065,6 +3129,11 @@ size_t os::pd_pretouch_memory(void* first, void* last, size_t page_size) {
       log_info(gc, os)("::madvise(" PTR_FORMAT ", " SIZE_FORMAT ", %d) failed; "
                        "error='%s' (errno=%d)", p2i(first), len,
                        MADV_POPULATE_WRITE, os::strerror(err), err);
+    } else {
+      // The range is populated now, but with defrag=defer or madvise the
+      // kernel may still have backed it with small pages and left the
+      // collapse to khugepaged. Collapse synchronously while we are here.
+      Linux::collapse_transparent_huge_pages(first, len);
     }
     return 0;
   }
@@ -4455,6 +4524,8 @@ void os::init(void) {
 
   // Check the availability of MADV_POPULATE_WRITE.
   FLAG_SET_DEFAULT(UseMadvPopulateWrite, (::madvise(0, 0, MADV_POPULATE_WRITE) == 0));
+  // Check the availability of MADV_COLLAPSE (Linux 6.1+).
+  FLAG_SET_DEFAULT(UseMadvCollapse, (::madvise(0, 0, MADV_COLLAPSE) == 0));
 
   os::Posix::init();
 }
@@ -188,11 +188,25 @@ class os::Linux {
 
   static void madvise_transparent_huge_pages(void* addr, size_t bytes);
 
+  // Synchronously collapse the populated range [addr, addr + bytes) into
+  // transparent huge pages with MADV_COLLAPSE, if supported.
+  static void collapse_transparent_huge_pages(void* addr, size_t bytes);
+  // Bytes passed to, and bytes that failed to collapse in,
+  // collapse_transparent_huge_pages() since startup.
+  static size_t thp_collapse_requested_bytes();
+  static size_t thp_collapse_failed_bytes();
+  // Log the huge page coverage achieved by collapse_transparent_huge_pages()
+  // since the counters had the given values.
+  static void log_thp_collapse_statistics(const char* name, size_t requested_before, size_t failed_before);
+
   // Stack repair handling
 
   // none present
 
  private:
+  static volatile size_t _thp_collapse_requested_bytes;
+  static volatile size_t _thp_collapse_failed_bytes;
+
   static void numa_init();
 
   typedef int (*sched_getcpu_func_t)(void);
@@ -437,6 +437,7 @@ void Compilation::install_code(int frame_size) {
     has_unsafe_access(),
     SharedRuntime::is_wide_vector(max_vector_size()),
     has_monitors(),
+    has_scoped_access(),
     _immediate_oops_patched
   );
 }
@@ -577,6 +578,7 @@ Compilation::Compilation(AbstractCompiler* compiler, ciEnv* env, ciMethod* metho
 , _would_profile(false)
 , _has_method_handle_invokes(false)
 , _has_reserved_stack_access(method->has_reserved_stack_access())
+, _has_scoped_access(method->is_scoped())
 , _has_monitors(method->is_synchronized() || method->has_monitor_bytecodes())
 , _install_code(install_code)
 , _bailout_msg(nullptr)
@@ -3515,6 +3515,9 @@ static void set_flags_for_inlined_callee(Compilation* compilation, ciMethod* cal
   if (callee->has_reserved_stack_access()) {
     compilation->set_has_reserved_stack_access(true);
   }
+  if (callee->is_scoped()) {
+    compilation->set_has_scoped_access(true);
+  }
   if (callee->is_synchronized() || callee->has_monitor_bytecodes()) {
     compilation->set_has_monitors(true);
   }
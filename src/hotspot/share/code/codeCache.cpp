@@ -434,7 +434,10 @@ void CodeCache::add_heap(ReservedSpace rs, const char* name, CodeBlobType code_b
   // Reserve Space
   size_t size_initial = MIN2((size_t)InitialCodeCacheSize, rs.size());
   size_initial = align_up(size_initial, os::vm_page_size());
-  if (!heap->reserve(rs, size_initial, CodeCacheSegmentSize)) {
+  // Profiled code is short-lived and gets replaced by tier-4 code, so it is
+  // kept off transparent huge pages unless requested.
+  bool use_large_pages = code_blob_type != CodeBlobType::MethodProfiled || ProfiledCodeHeapLargePages;
+  if (!heap->reserve(rs, size_initial, CodeCacheSegmentSize, use_large_pages)) {
     vm_exit_during_initialization(err_msg("Could not reserve enough space in %s (" SIZE_FORMAT "K)",
                                           heap->name(), size_initial/K));
   }
@@ -1358,15 +1361,18 @@ void CodeCache::mark_for_deoptimization(DeoptimizationScope* deopt_scope, Method
   }
 }
 
-void CodeCache::make_marked_nmethods_deoptimized() {
+uint CodeCache::make_marked_nmethods_deoptimized() {
+  uint count = 0;
   RelaxedNMethodIterator iter(RelaxedNMethodIterator::not_unloading);
   while(iter.next()) {
     nmethod* nm = iter.method();
     if (nm->is_marked_for_deoptimization() && !nm->has_been_deoptimized() && nm->can_be_deoptimized()) {
       nm->make_not_entrant();
       nm->make_deoptimized();
+      count++;
     }
   }
+  return count;
 }
 
 // Marks compiled methods dependent on dependee.
@@ -1730,10 +1736,12 @@ void CodeCache::print_summary(outputStream* st, bool detailed) {
                  size, used, max_used, free);
 
     if (detailed) {
-      st->print_cr(" bounds [" INTPTR_FORMAT ", " INTPTR_FORMAT ", " INTPTR_FORMAT "]",
+      st->print_cr(" bounds [" INTPTR_FORMAT ", " INTPTR_FORMAT ", " INTPTR_FORMAT "]"
+                   " commit_granularity=" SIZE_FORMAT "Kb",
                    p2i(heap->low_boundary()),
                    p2i(heap->high()),
-                   p2i(heap->high_boundary()));
+                   p2i(heap->high_boundary()),
+                   heap->commit_granularity()/K);
 
       full_count += get_codemem_full_count(heap->code_blob_type());
     }
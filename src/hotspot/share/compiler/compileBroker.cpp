@@ -451,6 +451,15 @@ CompileTask* CompileQueue::get(CompilerThread* thread) {
   return task;
 }
 
+jlong CompileQueue::oldest_wait_millis() {
+  MutexLocker locker(MethodCompileQueue_lock);
+  // Tasks are appended at the end, so the first one has waited longest.
+  if (_first == nullptr) {
+    return 0;
+  }
+  return (jlong)TimeHelper::counter_to_millis(os::elapsed_counter() - _first->time_queued());
+}
+
 // Clean & deallocate stale compile tasks.
 // Temporarily releases MethodCompileQueue lock.
 void CompileQueue::purge_stale_tasks() {
@@ -1021,6 +1030,25 @@ void CompileBroker::init_compiler_threads() {
 #endif // defined(ASSERT) && COMPILER2_OR_JVMCI
 }
 
+// Whether the oldest task in the queue has been waiting longer than
+// DynamicCompilerThreadsQueueLatency. Always false if the flag is 0.
+static bool compile_queue_is_starved(CompileQueue* queue) {
+  return queue != nullptr &&
+         DynamicCompilerThreadsQueueLatency > 0 &&
+         queue->oldest_wait_millis() > (jlong)DynamicCompilerThreadsQueueLatency;
+}
+
+// Number of compiler threads wanted for the given queue: one thread per
+// tasks_per_thread queued tasks, or one more than currently running if
+// the queue is starved.
+static int compiler_thread_demand(CompileQueue* queue, int tasks_per_thread, bool starved, int current_count) {
+  int demand = queue->size() / tasks_per_thread;
+  if (starved) {
+    demand = MAX2(demand, current_count + 1);
+  }
+  return demand;
+}
+
 void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
 
   julong free_memory = os::free_memory();
@@ -1028,13 +1056,18 @@ void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
   size_t available_cc_np  = CodeCache::unallocated_capacity(CodeBlobType::MethodNonProfiled),
          available_cc_p   = CodeCache::unallocated_capacity(CodeBlobType::MethodProfiled);
 
+  // Check the queueing latency before taking CompileThread_lock, as it
+  // needs MethodCompileQueue_lock.
+  bool c2_starved = compile_queue_is_starved(_c2_compile_queue);
+  bool c1_starved = compile_queue_is_starved(_c1_compile_queue);
+
   // Only do attempt to start additional threads if the lock is free.
   if (!CompileThread_lock->try_lock()) return;
 
   if (_c2_compile_queue != nullptr) {
     int old_c2_count = _compilers[1]->num_compiler_threads();
     int new_c2_count = MIN4(_c2_count,
-        _c2_compile_queue->size() / 2,
+        compiler_thread_demand(_c2_compile_queue, 2, c2_starved, old_c2_count),
         (int)(free_memory / (200*M)),
         (int)(available_cc_np / (128*K)));
 
@@ -1095,7 +1128,7 @@ void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
   if (_c1_compile_queue != nullptr) {
     int old_c1_count = _compilers[0]->num_compiler_threads();
     int new_c1_count = MIN4(_c1_count,
-        _c1_compile_queue->size() / 4,
+        compiler_thread_demand(_c1_compile_queue, 4, c1_starved, old_c1_count),
         (int)(free_memory / (100*M)),
         (int)(available_cc_p / (128*K)));
 
@@ -2114,8 +2147,21 @@ void CompileBroker::handle_compile_error(CompilerThread* thread, CompileTask* ta
   }
 }
 
-static void post_compilation_event(EventCompilation& event, CompileTask* task) {
+// Returns the CPU time of the current compiler thread, or -1 if it is not
+// needed for the Compilation event or not supported.
+static jlong compilation_cpu_time() {
+  if (EventCompilation::is_enabled() && os::is_thread_cpu_time_supported()) {
+    return os::current_thread_cpu_time();
+  }
+  return -1;
+}
+
+static void post_compilation_event(EventCompilation& event, CompileTask* task, jlong cpu_time_start) {
   assert(task != nullptr, "invariant");
+  jlong cpu_time = 0;
+  if (cpu_time_start >= 0) {
+    cpu_time = MAX2(compilation_cpu_time() - cpu_time_start, (jlong)0);
+  }
   CompilerEvent::CompilationEvent::post(event,
                                         task->compile_id(),
                                         task->compiler()->type(),
@@ -2125,7 +2171,8 @@ static void post_compilation_event(EventCompilation& event, CompileTask* task) {
                                         task->osr_bci() != CompileBroker::standard_entry_bci,
                                         task->nm_total_size(),
                                         task->num_inlined_bytecodes(),
-                                        task->arena_bytes());
+                                        task->arena_bytes(),
+                                        cpu_time);
 }
 
 int DirectivesStack::_depth = 0;
@@ -2171,6 +2218,7 @@ void CompileBroker::invoke_compiler_on_method(CompileTask* task) {
   bool should_break = false;
   const int task_level = task->comp_level();
   AbstractCompiler* comp = task->compiler();
+  const jlong cpu_time_start = compilation_cpu_time();
   {
     // create the handle inside it's own block so it can't
     // accidentally be referenced once the thread transitions to
@@ -2256,7 +2304,7 @@ void CompileBroker::invoke_compiler_on_method(CompileTask* task) {
       handle_compile_error(thread, task, nullptr, compilable, failure_reason);
     }
     if (event.should_commit()) {
-      post_compilation_event(event, task);
+      post_compilation_event(event, task, cpu_time_start);
     }
 
     if (runtime != nullptr) {
@@ -2337,7 +2385,7 @@ void CompileBroker::invoke_compiler_on_method(CompileTask* task) {
       handle_compile_error(thread, task, &ci_env, compilable, failure_reason);
     }
     if (event.should_commit()) {
-      post_compilation_event(event, task);
+      post_compilation_event(event, task, cpu_time_start);
     }
   }
 
@@ -122,6 +122,10 @@ class CompileQueue : public CHeapObj<mtCompiler> {
   uint        get_total_added()   const          { return _total_added; }
   uint        get_total_removed() const          { return _total_removed; }
 
+  // How long the oldest task in the queue has been waiting, in milliseconds,
+  // or 0 if the queue is empty. Takes MethodCompileQueue_lock.
+  jlong       oldest_wait_millis();
+
   // Redefine Classes support
   void mark_on_stack();
   void free_all();
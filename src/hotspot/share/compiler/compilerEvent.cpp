@@ -136,7 +136,7 @@ static inline void commit(EventType& event) {
 
 void CompilerEvent::CompilationEvent::post(EventCompilation& event, int compile_id, CompilerType compiler_type, Method* method,
     int compile_level, bool success, bool is_osr, int code_size,
-    int inlined_bytecodes, size_t arenaBytes) {
+    int inlined_bytecodes, size_t arenaBytes, jlong cpu_time) {
   event.set_compileId(compile_id);
   event.set_compiler(compiler_type);
   event.set_method(method);
@@ -146,6 +146,7 @@ void CompilerEvent::CompilationEvent::post(EventCompilation& event, int compile_
   event.set_codeSize(code_size);
   event.set_inlinedBytes(inlined_bytecodes);
   event.set_arenaBytes(arenaBytes);
+  event.set_cpuTime(cpu_time);
   commit(event);
 }
 
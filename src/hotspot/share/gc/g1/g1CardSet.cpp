@@ -112,7 +112,8 @@ G1CardSetConfiguration::G1CardSetConfiguration(uint inline_ptr_bits_per_card,
   _log2_max_cards_in_howl_bitmap(log2i_exact(_max_cards_in_howl_bitmap)),
   _bitmap_hash_mask((1U << _log2_max_cards_in_howl_bitmap) - 1),
   _log2_card_regions_per_heap_region(log2_card_regions_per_heap_region),
-  _log2_cards_per_card_region(log2i_exact(_max_cards_in_card_set)) {
+  _log2_cards_per_card_region(log2i_exact(_max_cards_in_card_set)),
+  _popular_coarsen_threshold(G1RemSetPopularCoarsenThreshold) {
 
   assert(_inline_ptr_bits_per_card <= G1CardSetContainer::LogCardsPerRegionLimit,
          "inline_ptr_bits_per_card (%u) is wasteful, can represent more than maximum possible card indexes (%u)",
@@ -164,13 +165,15 @@ void G1CardSetConfiguration::log_configuration() {
                           "Array Of Cards #cards %u size %zu "
                           "Howl #buckets %u coarsen threshold %u "
                           "Howl Bitmap #cards %u size %zu coarsen threshold %u "
-                          "Card regions per heap region %u cards per card region %u",
+                          "Card regions per heap region %u cards per card region %u "
+                          "Popular coarsen threshold %u",
                           max_cards_in_inline_ptr(), sizeof(void*),
                           max_cards_in_array(), G1CardSetArray::size_in_bytes(max_cards_in_array()),
                           num_buckets_in_howl(), cards_in_howl_threshold(),
                           max_cards_in_howl_bitmap(), G1CardSetBitMap::size_in_bytes(max_cards_in_howl_bitmap()), cards_in_howl_bitmap_threshold(),
                           (uint)1 << log2_card_regions_per_heap_region(),
-                          max_cards_in_region());
+                          max_cards_in_region(),
+                          popular_coarsen_threshold());
 }
 
 uint G1CardSetConfiguration::max_cards_in_inline_ptr() const {
@@ -385,7 +388,9 @@ G1CardSet::G1CardSet(G1CardSetConfiguration* config, G1CardSetMemoryManager* mm)
   _mm(mm),
   _config(config),
   _table(new G1CardSetHashTable(mm)),
-  _num_occupied(0) {
+  _num_occupied(0),
+  _num_array_to_howl_coarsenings(0),
+  _num_inline_ptr_to_howl_coarsenings(0) {
 }
 
 G1CardSet::~G1CardSet() {
@@ -615,6 +620,12 @@ bool G1CardSet::coarsen_container(ContainerPtr volatile* container_addr,
       break;
     }
     case ContainerInlinePtr: {
+      if (!within_howl && is_popular()) {
+        // Card regions in popular card sets are likely to overflow an Array of Cards
+        // container too, so go directly to Howl.
+        new_container = create_coarsened_array_of_cards(card_in_region, within_howl);
+        break;
+      }
       uint const size = _config->max_cards_in_array();
       uint8_t* data = allocate_mem_object(ContainerArrayOfCards);
       new (data) G1CardSetArray(card_in_region, size);
@@ -638,6 +649,9 @@ bool G1CardSet::coarsen_container(ContainerPtr volatile* container_addr,
     // check its result).
     bool should_free = release_container(cur_container);
     assert(!should_free, "must have had more than one reference");
+    if (!within_howl && container_type(new_container) == ContainerHowl && new_container != FullCardSet) {
+      record_howl_coarsening(cur_container);
+    }
     // Free containers if cur_container is ContainerHowl
     if (container_type(cur_container) == ContainerHowl) {
       G1ReleaseCardsets rel(this);
@@ -654,6 +668,20 @@ bool G1CardSet::coarsen_container(ContainerPtr volatile* container_addr,
   }
 }
 
+bool G1CardSet::is_popular() const {
+  uint const threshold = _config->popular_coarsen_threshold();
+  return threshold != 0 && Atomic::load(&_num_array_to_howl_coarsenings) >= threshold;
+}
+
+void G1CardSet::record_howl_coarsening(ContainerPtr from_container) {
+  if (container_type(from_container) == ContainerArrayOfCards) {
+    Atomic::inc(&_num_array_to_howl_coarsenings, memory_order_relaxed);
+  } else {
+    assert(container_type(from_container) == ContainerInlinePtr, "must be");
+    Atomic::inc(&_num_inline_ptr_to_howl_coarsenings, memory_order_relaxed);
+  }
+}
+
 class G1TransferCard : public StackObj {
   G1CardSet* _card_set;
   uint _region_idx;
@@ -1036,6 +1064,8 @@ size_t G1CardSet::static_mem_size() {
 void G1CardSet::clear() {
   _table->reset();
   _num_occupied = 0;
+  _num_array_to_howl_coarsenings = 0;
+  _num_inline_ptr_to_howl_coarsenings = 0;
   _mm->flush();
 }
 
@@ -58,6 +58,7 @@ class G1CardSetConfiguration {
   uint _bitmap_hash_mask;
   uint _log2_card_regions_per_heap_region;
   uint _log2_cards_per_card_region;
+  uint _popular_coarsen_threshold;
 
   G1CardSetAllocOptions* _card_set_alloc_options;
 
@@ -110,6 +111,10 @@ class G1CardSetConfiguration {
   // Given a card index, return the bucket in the array of card sets.
   uint howl_bucket_index(uint card_idx) { return card_idx >> _log2_max_cards_in_howl_bitmap; }
 
+  // Number of coarsenings from Array of Cards to Howl in a card set after which that
+  // card set is considered popular; 0 if disabled.
+  uint popular_coarsen_threshold() const { return _popular_coarsen_threshold; }
+
   // Full card configuration
   // Maximum number of cards in a non-full card set for a single card region. Card sets
   // with more entries per region are coarsened to Full.
@@ -273,6 +278,18 @@ class G1CardSet : public CHeapObj<mtGCCardSet> {
   // be (slightly) more cards in the card set than this value in reality.
   size_t _num_occupied;
 
+  // Number of successful coarsenings of top-level Array of Cards containers into
+  // Howl containers since the last clear. Used as a measure of popularity of the
+  // area covered by this card set: popular card sets directly coarsen Inline Ptr
+  // containers into Howl containers, skipping the Array of Cards step that would
+  // very likely overflow again.
+  uint volatile _num_array_to_howl_coarsenings;
+  // Number of Inline Ptr containers directly coarsened into Howl containers.
+  uint volatile _num_inline_ptr_to_howl_coarsenings;
+
+  // Record a successful coarsening of the given top-level container into a Howl container.
+  void record_howl_coarsening(ContainerPtr from_container);
+
   ContainerPtr make_container_ptr(void* value, uintptr_t type);
 
   ContainerPtr acquire_container(ContainerPtr volatile* container_addr);
@@ -366,6 +383,12 @@ class G1CardSet : public CHeapObj<mtGCCardSet> {
 
   size_t num_containers();
 
+  // Returns whether this card set sees many coarsenings into Howl containers and
+  // has been adapted to skip the Array of Cards containers for new card regions.
+  bool is_popular() const;
+  // Number of Inline Ptr containers coarsened directly to Howl due to popularity.
+  uint num_inline_ptr_to_howl_coarsenings() const { return _num_inline_ptr_to_howl_coarsenings; }
+
   static G1CardSetCoarsenStats coarsen_stats();
   static void print_coarsen_stats(outputStream* out);
 
@@ -1951,6 +1951,13 @@ void G1CollectedHeap::heap_region_par_iterate_from_start(HeapRegionClosure* cl,
   _hrm.par_iterate(cl, hrclaimer, 0);
 }
 
+void G1CollectedHeap::heap_region_par_iterate_on_node_from_worker_offset(HeapRegionClosure* cl,
+                                                                         HeapRegionClaimer* hrclaimer,
+                                                                         uint worker_id,
+                                                                         uint node_index) const {
+  _hrm.par_iterate_on_node(cl, hrclaimer, hrclaimer->offset_for_worker(worker_id), node_index);
+}
+
 void G1CollectedHeap::collection_set_iterate_all(HeapRegionClosure* cl) {
   _collection_set.iterate(cl);
 }
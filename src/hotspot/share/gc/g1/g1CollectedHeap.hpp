@@ -1103,6 +1103,13 @@ class G1CollectedHeap : public CollectedHeap {
   void heap_region_par_iterate_from_start(HeapRegionClosure* cl,
                                           HeapRegionClaimer* hrclaimer) const;
 
+  // As heap_region_par_iterate_from_worker_offset(), but only visits regions
+  // attributed to the given NUMA node index.
+  void heap_region_par_iterate_on_node_from_worker_offset(HeapRegionClosure* cl,
+                                                          HeapRegionClaimer* hrclaimer,
+                                                          uint worker_id,
+                                                          uint node_index) const;
+
   // Iterate over all regions in the collection set in parallel.
   void collection_set_par_iterate_all(HeapRegionClosure* cl,
                                       HeapRegionClaimer* hr_claimer,
@@ -30,6 +30,7 @@
 #include "gc/g1/g1ConcurrentMarkBitMap.inline.hpp"
 #include "gc/g1/g1HeapRegion.inline.hpp"
 #include "gc/g1/g1HeapRegionManager.inline.hpp"
+#include "gc/g1/g1NUMA.hpp"
 #include "gc/shared/gc_globals.hpp"
 #include "gc/shared/suspendibleThreadSet.hpp"
 #include "gc/shared/workerThread.hpp"
@@ -61,12 +62,22 @@
 // we need to scan objects to rebuild remembered sets until tars.
 // Regions might have been reclaimed while scrubbing them after having yielded for
 // a pause.
+//
+// With NUMA enabled, every worker first processes the regions located on its own
+// node, and only then helps out with regions on any node.
 class G1RebuildRSAndScrubTask : public WorkerTask {
   G1ConcurrentMark* _cm;
   HeapRegionClaimer _hr_claimer;
 
   const bool _should_rebuild_remset;
 
+  G1NUMA* _numa;
+  const uint _num_workers;
+  // Per worker node index and number of processed regions per node. Only
+  // allocated if NUMA statistics are logged.
+  uint* _worker_node_index;
+  size_t* _region_node_stat;
+
   class G1RebuildRSAndScrubRegionClosure : public HeapRegionClosure {
     G1ConcurrentMark* _cm;
     const G1CMBitMap* _bitmap;
@@ -77,6 +88,9 @@ class G1RebuildRSAndScrubTask : public WorkerTask {
 
     size_t _processed_words;
 
+    // Per node count of regions processed by this worker, may be null.
+    size_t* _region_node_stat;
+
     const size_t ProcessingYieldLimitInWords = G1RebuildRemSetChunkSize / HeapWordSize;
 
     void reset_processed_words() {
@@ -286,13 +300,20 @@ class G1RebuildRSAndScrubTask : public WorkerTask {
       return false;
     }
 
+    void update_numa_stats(G1HeapRegion* hr) {
+      if (_region_node_stat != nullptr && hr->node_index() < G1NUMA::numa()->num_active_nodes()) {
+        _region_node_stat[hr->node_index()]++;
+      }
+    }
+
   public:
-    G1RebuildRSAndScrubRegionClosure(G1ConcurrentMark* cm, bool should_rebuild_remset, uint worker_id) :
+    G1RebuildRSAndScrubRegionClosure(G1ConcurrentMark* cm, bool should_rebuild_remset, uint worker_id, size_t* region_node_stat) :
       _cm(cm),
       _bitmap(_cm->mark_bitmap()),
       _rebuild_closure(G1CollectedHeap::heap(), worker_id),
       _should_rebuild_remset(should_rebuild_remset),
-      _processed_words(0) { }
+      _processed_words(0),
+      _region_node_stat(region_node_stat) { }
 
     bool do_heap_region(G1HeapRegion* hr) {
       // Avoid stalling safepoints and stop iteration if mark cycle has been aborted.
@@ -312,6 +333,8 @@ class G1RebuildRSAndScrubTask : public WorkerTask {
         return false;
       }
 
+      update_numa_stats(hr);
+
       bool mark_aborted;
       if (hr->needs_scrubbing()) {
         // This is a region with potentially unparsable (dead) objects.
@@ -326,20 +349,76 @@ class G1RebuildRSAndScrubTask : public WorkerTask {
     }
   };
 
+  size_t* region_node_stat_for_worker(uint worker_id) const {
+    if (_region_node_stat == nullptr) {
+      return nullptr;
+    }
+    return &_region_node_stat[worker_id * _numa->num_active_nodes()];
+  }
+
 public:
   G1RebuildRSAndScrubTask(G1ConcurrentMark* cm, bool should_rebuild_remset, uint num_workers) :
     WorkerTask("Scrub dead objects"),
     _cm(cm),
     _hr_claimer(num_workers),
-    _should_rebuild_remset(should_rebuild_remset) { }
+    _should_rebuild_remset(should_rebuild_remset),
+    _numa(G1NUMA::numa()),
+    _num_workers(num_workers),
+    _worker_node_index(nullptr),
+    _region_node_stat(nullptr) {
+
+    if (_numa->is_enabled() && log_is_enabled(Info, gc, heap, numa)) {
+      uint num_nodes = _numa->num_active_nodes();
+      _worker_node_index = NEW_C_HEAP_ARRAY(uint, _num_workers, mtGC);
+      _region_node_stat = NEW_C_HEAP_ARRAY(size_t, _num_workers * num_nodes, mtGC);
+      for (uint i = 0; i < _num_workers; i++) {
+        _worker_node_index[i] = G1NUMA::UnknownNodeIndex;
+      }
+      memset(_region_node_stat, 0, sizeof(size_t) * _num_workers * num_nodes);
+    }
+  }
+
+  ~G1RebuildRSAndScrubTask() {
+    FREE_C_HEAP_ARRAY(uint, _worker_node_index);
+    FREE_C_HEAP_ARRAY(size_t, _region_node_stat);
+  }
 
   void work(uint worker_id) {
     SuspendibleThreadSetJoiner sts_join;
 
     G1CollectedHeap* g1h = G1CollectedHeap::heap();
-    G1RebuildRSAndScrubRegionClosure cl(_cm, _should_rebuild_remset, worker_id);
+    G1RebuildRSAndScrubRegionClosure cl(_cm, _should_rebuild_remset, worker_id, region_node_stat_for_worker(worker_id));
+
+    if (_numa->is_enabled()) {
+      uint node_index = _numa->index_of_current_thread();
+      if (_worker_node_index != nullptr) {
+        _worker_node_index[worker_id] = node_index;
+      }
+      // Process regions on the local node first to avoid remote memory accesses
+      // as long as there is local work.
+      g1h->heap_region_par_iterate_on_node_from_worker_offset(&cl, &_hr_claimer, worker_id, node_index);
+      if (_cm->has_aborted()) {
+        return;
+      }
+    }
     g1h->heap_region_par_iterate_from_worker_offset(&cl, &_hr_claimer, worker_id);
   }
+
+  // Publish the per worker region locality statistics. Must be called after the
+  // task completed as G1NUMAStats is not thread-safe.
+  void flush_numa_stats() {
+    if (_region_node_stat == nullptr) {
+      return;
+    }
+    // Do not race with printing the statistics in a pause.
+    SuspendibleThreadSetJoiner sts_join;
+    for (uint worker_id = 0; worker_id < _num_workers; worker_id++) {
+      uint node_index = _worker_node_index[worker_id];
+      if (node_index < _numa->num_active_nodes()) {
+        _numa->copy_statistics(G1NUMAStats::LocalRegionProcessAtRebuild, node_index, region_node_stat_for_worker(worker_id));
+      }
+    }
+  }
 };
 
 void G1ConcurrentRebuildAndScrub::rebuild_and_scrub(G1ConcurrentMark* cm, bool should_rebuild_remset, WorkerThreads* workers) {
@@ -347,4 +426,5 @@ void G1ConcurrentRebuildAndScrub::rebuild_and_scrub(G1ConcurrentMark* cm, bool s
 
   G1RebuildRSAndScrubTask task(cm, should_rebuild_remset, num_workers);
   workers->run_task(&task, num_workers);
+  task.flush_numa_stats();
 }
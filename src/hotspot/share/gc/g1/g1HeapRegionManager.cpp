@@ -575,6 +575,15 @@ bool HeapRegionManager::allocate_containing_regions(MemRegion range, size_t* com
 }
 
 void HeapRegionManager::par_iterate(HeapRegionClosure* blk, HeapRegionClaimer* hrclaimer, const uint start_index) const {
+  par_iterate_impl(blk, hrclaimer, start_index, G1NUMA::AnyNodeIndex);
+}
+
+void HeapRegionManager::par_iterate_on_node(HeapRegionClosure* blk, HeapRegionClaimer* hrclaimer, const uint start_index, uint node_index) const {
+  assert(node_index < G1NUMA::numa()->num_active_nodes(), "Invalid node index %u", node_index);
+  par_iterate_impl(blk, hrclaimer, start_index, node_index);
+}
+
+void HeapRegionManager::par_iterate_impl(HeapRegionClosure* blk, HeapRegionClaimer* hrclaimer, const uint start_index, uint node_index) const {
   // Every worker will actually look at all regions, skipping over regions that
   // are currently not committed.
   // This also (potentially) iterates over regions newly allocated during GC. This
@@ -588,6 +597,10 @@ void HeapRegionManager::par_iterate(HeapRegionClosure* blk, HeapRegionClaimer* h
       continue;
     }
     G1HeapRegion* r = _regions.get_by_index(index);
+    // Skip regions located on other nodes if requested; they must stay unclaimed.
+    if (node_index != G1NUMA::AnyNodeIndex && r->node_index() != node_index) {
+      continue;
+    }
     // We'll ignore regions already claimed.
     if (hrclaimer->is_region_claimed(index)) {
       continue;
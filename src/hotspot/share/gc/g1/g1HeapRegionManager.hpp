@@ -111,6 +111,8 @@ class HeapRegionManager: public CHeapObj<mtGC> {
   // sequence could be found, otherwise res_idx contains the start index of this range.
   uint find_empty_from_idx_reverse(uint start_idx, uint* res_idx) const;
 
+  void par_iterate_impl(HeapRegionClosure* blk, HeapRegionClaimer* hrclaimer, const uint start_index, uint node_index) const;
+
   // Checks the G1MemoryNodeManager to see if this region is on the preferred node.
   bool is_on_preferred_index(uint region_index, uint preferred_node_index);
 
@@ -272,6 +274,9 @@ class HeapRegionManager: public CHeapObj<mtGC> {
   void iterate(HeapRegionIndexClosure* blk) const;
 
   void par_iterate(HeapRegionClosure* blk, HeapRegionClaimer* hrclaimer, const uint start_index) const;
+  // As par_iterate(), but only claims regions whose memory is attributed to the
+  // given NUMA node index. Regions on other nodes are left for other iterations.
+  void par_iterate_on_node(HeapRegionClosure* blk, HeapRegionClaimer* hrclaimer, const uint start_index, uint node_index) const;
 
   // Uncommit up to num_regions_to_remove regions that are completely free.
   // Return the actual number of uncommitted regions.
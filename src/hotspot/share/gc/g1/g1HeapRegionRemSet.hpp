@@ -81,6 +81,11 @@ class HeapRegionRemSet : public CHeapObj<mtGC> {
     return _card_set.occupied();
   }
 
+  // Returns whether the card set adapted its container selection to many incoming
+  // references, see G1RemSetPopularCoarsenThreshold.
+  bool is_popular() const { return _card_set.is_popular(); }
+  uint num_inline_ptr_to_howl_coarsenings() const { return _card_set.num_inline_ptr_to_howl_coarsenings(); }
+
   static void initialize(MemRegion reserved);
 
   // Coarsening statistics since VM start.
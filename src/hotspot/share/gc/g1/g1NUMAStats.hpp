@@ -87,6 +87,8 @@ class G1NUMAStats : public CHeapObj<mtGC> {
     NewRegionAlloc,
     // Statistics of object processing during copy to survivor region.
     LocalObjProcessAtCopyToSurv,
+    // Statistics of regions processed by the concurrent rebuild and scrub task.
+    LocalRegionProcessAtRebuild,
     NodeDataItemsSentinel
   };
 
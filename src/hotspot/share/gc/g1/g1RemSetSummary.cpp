@@ -208,11 +208,16 @@ class HRRSStatsIter: public HeapRegionClosure {
   size_t max_code_root_mem_sz() const       { return _max_code_root_mem_sz; }
   G1HeapRegion* max_code_root_mem_sz_region() const { return _max_code_root_mem_sz_region; }
 
+  // Remembered sets that adapted their container selection to popularity.
+  size_t _num_popular_rs;
+  size_t _num_popular_coarsenings;
+
 public:
   HRRSStatsIter() : _young("Young"), _humongous("Humongous"),
     _free("Free"), _old("Old"), _all("All"),
     _max_rs_mem_sz(0), _max_rs_mem_sz_region(nullptr),
-    _max_code_root_mem_sz(0), _max_code_root_mem_sz_region(nullptr)
+    _max_code_root_mem_sz(0), _max_code_root_mem_sz_region(nullptr),
+    _num_popular_rs(0), _num_popular_coarsenings(0)
   {}
 
   bool do_heap_region(G1HeapRegion* r) {
@@ -234,6 +239,11 @@ class HRRSStatsIter: public HeapRegionClosure {
     }
     size_t code_root_elems = hrrs->code_roots_list_length();
 
+    if (hrrs->is_popular()) {
+      _num_popular_rs++;
+    }
+    _num_popular_coarsenings += hrrs->num_inline_ptr_to_howl_coarsenings();
+
     RegionTypeCounter* current = nullptr;
     if (r->is_free()) {
       current = &_free;
@@ -281,6 +291,12 @@ class HRRSStatsIter: public HeapRegionClosure {
                   rem_set->mem_size(),
                   rem_set->occupied());
 
+    if (G1RemSetPopularCoarsenThreshold != 0) {
+      out->print_cr("    " SIZE_FORMAT " popular rem sets, " SIZE_FORMAT " Inline Ptr "
+                    "containers coarsened directly to Howl.",
+                    _num_popular_rs, _num_popular_coarsenings);
+    }
+
     HeapRegionRemSet::print_static_mem_size(out);
     G1CollectedHeap* g1h = G1CollectedHeap::heap();
     g1h->card_set_freelist_pool()->print_on(out);
@@ -647,6 +647,8 @@ class G1EvacuateRegionsBaseTask : public WorkerTask {
 
       G1ParScanThreadState* pss = _per_thread_states->state_for_worker(worker_id);
       pss->set_ref_discoverer(_g1h->ref_processor_stw());
+      // Let other workers know which node our queue lives on for stealing.
+      _task_queues->update_numa_node(worker_id);
 
       scan_roots(pss, worker_id);
       evacuate_live_objects(pss, worker_id);
@@ -209,6 +209,13 @@
           "set container.")                                                 \
           range(1, 100)                                                     \
                                                                             \
+  product(uint, G1RemSetPopularCoarsenThreshold, 0, EXPERIMENTAL,           \
+          "Number of coarsenings of Array of Cards to Howl card set "       \
+          "containers within a single remembered set after which new "      \
+          "card regions are directly coarsened from Inline Ptr to Howl "    \
+          "card set containers. 0 disables this adaptation.")               \
+          range(0, max_juint)                                               \
+                                                                            \
   develop(size_t, G1MaxVerifyFailures, SIZE_MAX,                            \
           "The maximum number of liveness and remembered set verification " \
           "failures to print per thread.")                                  \
@@ -851,6 +851,184 @@ bool PSParallelCompact::reassess_maximum_compaction(bool maximum_compaction,
   return false;
 }
 
+// Work on the region table in the summary phase is split into chunks of this
+// many regions, which are claimed by the workers.
+static const size_t SummaryChunkRegions = 1024;
+
+static uint summary_phase_workers(size_t num_regions) {
+  if (num_regions < 2 * SummaryChunkRegions) {
+    // Not worth waking up the workers.
+    return 1;
+  }
+  const size_t num_chunks = align_up(num_regions, SummaryChunkRegions) / SummaryChunkRegions;
+  return (uint)MIN2(num_chunks, (size_t)ParallelScavengeHeap::heap()->workers().active_workers());
+}
+
+class PCSummaryChunkClaimer {
+  const size_t    _end_region;
+  volatile size_t _next_region;
+
+public:
+  PCSummaryChunkClaimer(size_t beg_region, size_t end_region) :
+    _end_region(end_region),
+    _next_region(beg_region) {}
+
+  bool claim(size_t* chunk_beg, size_t* chunk_end) {
+    if (Atomic::load(&_next_region) >= _end_region) {
+      return false;
+    }
+    const size_t beg = Atomic::fetch_then_add(&_next_region, SummaryChunkRegions);
+    if (beg >= _end_region) {
+      return false;
+    }
+    *chunk_beg = beg;
+    *chunk_end = MIN2(beg + SummaryChunkRegions, _end_region);
+    return true;
+  }
+};
+
+// Parallel version of ParallelCompactData::live_words_in_space() for the
+// old space, also computing the end of the prefix of full regions.
+class PCLiveWordsInOldSpaceTask : public WorkerTask {
+  const size_t          _end_region;
+  PCSummaryChunkClaimer _claimer;
+  volatile size_t       _live_words;
+  volatile size_t       _first_non_full_region;
+
+public:
+  PCLiveWordsInOldSpaceTask(size_t beg_region, size_t end_region) :
+    WorkerTask("PCLiveWordsInOldSpaceTask"),
+    _end_region(end_region),
+    _claimer(beg_region, end_region),
+    _live_words(0),
+    _first_non_full_region(end_region) {}
+
+  void work(uint worker_id) override {
+    const ParallelCompactData& sd = PSParallelCompact::summary_data();
+    size_t live_words = 0;
+    size_t chunk_beg;
+    size_t chunk_end;
+    while (_claimer.claim(&chunk_beg, &chunk_end)) {
+      size_t first_non_full = _end_region;
+      for (size_t cur_region = chunk_beg; cur_region < chunk_end; ++cur_region) {
+        const size_t live_words_in_region = sd.region(cur_region)->data_size();
+        if (first_non_full == _end_region && live_words_in_region < ParallelCompactData::RegionSize) {
+          first_non_full = cur_region;
+        }
+        live_words += live_words_in_region;
+      }
+      // Keep the minimum over all chunks.
+      size_t cur = Atomic::load(&_first_non_full_region);
+      while (first_non_full < cur) {
+        const size_t prev = Atomic::cmpxchg(&_first_non_full_region, cur, first_non_full);
+        if (prev == cur) {
+          break;
+        }
+        cur = prev;
+      }
+    }
+    Atomic::add(&_live_words, live_words);
+  }
+
+  size_t live_words() const { return _live_words; }
+
+  HeapWord* full_region_prefix_end(const MutableSpace* space) const {
+    const ParallelCompactData& sd = PSParallelCompact::summary_data();
+    HeapWord* prefix_end;
+    if (_first_non_full_region == _end_region) {
+      // All regions are full of live objs.
+      assert(sd.is_region_aligned(space->top()), "inv");
+      prefix_end = space->top();
+    } else {
+      prefix_end = sd.region_to_addr(_first_non_full_region);
+    }
+    assert(prefix_end != nullptr, "postcondition");
+    assert(sd.is_region_aligned(prefix_end), "inv");
+    assert(prefix_end >= space->bottom(), "in-range");
+    assert(prefix_end <= space->top(), "in-range");
+    return prefix_end;
+  }
+};
+
+// Parallel version of ParallelCompactData::summarize_dense_prefix(); the
+// regions in the dense prefix are independent of each other.
+class PCSummarizeDensePrefixTask : public WorkerTask {
+  PCSummaryChunkClaimer _claimer;
+
+public:
+  PCSummarizeDensePrefixTask(size_t beg_region, size_t end_region) :
+    WorkerTask("PCSummarizeDensePrefixTask"),
+    _claimer(beg_region, end_region) {}
+
+  void work(uint worker_id) override {
+    ParallelCompactData& sd = PSParallelCompact::summary_data();
+    size_t chunk_beg;
+    size_t chunk_end;
+    while (_claimer.claim(&chunk_beg, &chunk_end)) {
+      sd.summarize_dense_prefix(sd.region_to_addr(chunk_beg), sd.region_to_addr(chunk_end));
+    }
+  }
+};
+
+size_t PSParallelCompact::live_words_in_old_space(HeapWord** full_region_prefix_end) {
+  GCTraceTime(Debug, gc, phases) tm("Live Words In Old Space", &_gc_timer);
+
+  MutableSpace* const old_space = _space_info[old_space_id].space();
+  const size_t beg_region = _summary_data.addr_to_region_idx(old_space->bottom());
+  const size_t end_region = _summary_data.addr_to_region_idx(_summary_data.region_align_up(old_space->top()));
+  const uint num_workers = summary_phase_workers(end_region - beg_region);
+  if (num_workers <= 1) {
+    return _summary_data.live_words_in_space(old_space, full_region_prefix_end);
+  }
+
+  PCLiveWordsInOldSpaceTask task(beg_region, end_region);
+  ParallelScavengeHeap::heap()->workers().run_task(&task, num_workers);
+  *full_region_prefix_end = task.full_region_prefix_end(old_space);
+
+#ifdef ASSERT
+  // Cross-check against the serial computation.
+  HeapWord* serial_prefix_end = nullptr;
+  const size_t serial_live_words = _summary_data.live_words_in_space(old_space, &serial_prefix_end);
+  assert(task.live_words() == serial_live_words,
+         "parallel live words " SIZE_FORMAT " != serial " SIZE_FORMAT,
+         task.live_words(), serial_live_words);
+  assert(*full_region_prefix_end == serial_prefix_end,
+         "parallel full region prefix end " PTR_FORMAT " != serial " PTR_FORMAT,
+         p2i(*full_region_prefix_end), p2i(serial_prefix_end));
+#endif
+
+  return task.live_words();
+}
+
+void PSParallelCompact::summarize_dense_prefix(HeapWord* beg, HeapWord* end) {
+  GCTraceTime(Debug, gc, phases) tm("Summarize Dense Prefix", &_gc_timer);
+
+  const size_t beg_region = _summary_data.addr_to_region_idx(beg);
+  const size_t end_region = _summary_data.addr_to_region_idx(end);
+  const uint num_workers = summary_phase_workers(end_region - beg_region);
+  if (num_workers <= 1) {
+    _summary_data.summarize_dense_prefix(beg, end);
+    return;
+  }
+
+  PCSummarizeDensePrefixTask task(beg_region, end_region);
+  ParallelScavengeHeap::heap()->workers().run_task(&task, num_workers);
+
+#ifdef ASSERT
+  // Check that every region got what the serial version would have set.
+  HeapWord* addr = beg;
+  for (size_t cur_region = beg_region; cur_region < end_region; ++cur_region) {
+    const ParallelCompactData::RegionData* const r = _summary_data.region(cur_region);
+    assert(r->destination() == addr, "region " SIZE_FORMAT " has wrong destination", cur_region);
+    assert(r->destination_count() == 0, "region " SIZE_FORMAT " has destination count %u",
+           cur_region, r->destination_count());
+    assert(r->source_region() == cur_region, "region " SIZE_FORMAT " has wrong source region", cur_region);
+    assert(r->data_size() == ParallelCompactData::RegionSize, "region " SIZE_FORMAT " is not full", cur_region);
+    addr += ParallelCompactData::RegionSize;
+  }
+#endif
+}
+
 void PSParallelCompact::summary_phase(bool maximum_compaction)
 {
   GCTraceTime(Info, gc, phases) tm("Summary Phase", &_gc_timer);
@@ -861,8 +1039,7 @@ void PSParallelCompact::summary_phase(bool maximum_compaction)
     HeapWord* full_region_prefix_end = nullptr;
     {
       // old-gen
-      size_t live_words = _summary_data.live_words_in_space(old_space,
-                                                            &full_region_prefix_end);
+      size_t live_words = live_words_in_old_space(&full_region_prefix_end);
       total_live_words += live_words;
     }
     // young-gen
@@ -887,7 +1064,7 @@ void PSParallelCompact::summary_phase(bool maximum_compaction)
 
     if (dense_prefix_end != old_space->bottom()) {
       fill_dense_prefix_end(id);
-      _summary_data.summarize_dense_prefix(old_space->bottom(), dense_prefix_end);
+      summarize_dense_prefix(old_space->bottom(), dense_prefix_end);
     }
     _summary_data.summarize(_space_info[id].split_info(),
                             dense_prefix_end, old_space->top(), nullptr,
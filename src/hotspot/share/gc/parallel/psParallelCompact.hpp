@@ -739,6 +739,10 @@ class PSParallelCompact : AllStatic {
   // make the heap parsable.
   static void fill_dense_prefix_end(SpaceId id);
 
+  // Helpers for summary_phase(); these use the workers for large old spaces.
+  static size_t live_words_in_old_space(HeapWord** full_region_prefix_end);
+  static void summarize_dense_prefix(HeapWord* beg, HeapWord* end);
+
   static void summary_phase(bool maximum_compaction);
 
   static void adjust_pointers();
@@ -308,6 +308,9 @@ class ScavengeRootsTask : public WorkerTask {
     assert(worker_id < _active_workers, "Sanity");
     ResourceMark rm;
 
+    // Let other workers know which node our queue lives on for stealing.
+    PSPromotionManager::stack_array_depth()->update_numa_node(worker_id);
+
     if (!_is_old_gen_empty) {
       // There are only old-to-young pointers if there are objects
       // in the old gen.
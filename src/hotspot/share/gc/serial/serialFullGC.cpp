@@ -650,7 +650,13 @@ void SerialFullGC::adjust_marks() {
 }
 
 void SerialFullGC::restore_marks() {
-  log_trace(gc)("Restoring " SIZE_FORMAT " marks", _preserved_count + _preserved_overflow_stack_set.get()->size());
+  GCTraceTime(Debug, gc, phases) tm("Restore Marks", _gc_timer);
+
+  // Marks that did not fit into the scratch area were pushed to the
+  // overflow stack, which costs C heap memory during full GC.
+  log_debug(gc)("Restoring " SIZE_FORMAT " marks (scratch: " SIZE_FORMAT "/" SIZE_FORMAT ", overflow: " SIZE_FORMAT ")",
+                _preserved_count + _preserved_overflow_stack_set.get()->size(),
+                _preserved_count, _preserved_count_max, _preserved_overflow_stack_set.get()->size());
 
   // restore the marks we saved earlier
   for (size_t i = 0; i < _preserved_count; i++) {
@@ -30,6 +30,10 @@
 #include "runtime/globals.hpp"
 #include "runtime/os.hpp"
 #include "utilities/align.hpp"
+#include "utilities/macros.hpp"
+#ifdef LINUX
+#include "os_linux.hpp"
+#endif
 
 PretouchTask::PretouchTask(const char* task_name,
                            char* start_address,
@@ -75,6 +79,11 @@ void PretouchTask::pretouch(const char* task_name, char* start_address, char* en
     return;
   }
 
+#ifdef LINUX
+  const size_t collapse_requested = os::Linux::thp_collapse_requested_bytes();
+  const size_t collapse_failed = os::Linux::thp_collapse_failed_bytes();
+#endif
+
   if (pretouch_workers != nullptr) {
     size_t num_chunks = ((total_bytes - 1) / chunk_size) + 1;
 
@@ -88,4 +97,5 @@ void PretouchTask::pretouch(const char* task_name, char* start_address, char* en
                         task.name(), total_bytes);
     task.work(0);
   }
+  LINUX_ONLY(os::Linux::log_thp_collapse_statistics(task.name(), collapse_requested, collapse_failed);)
 }
@@ -35,7 +35,7 @@
 #if TASKQUEUE_STATS
 const char * const TaskQueueStats::_names[last_stat_id] = {
   "push", "pop", "pop-slow",
-  "st-attempt", "st-empty", "st-ctdd", "st-success", "st-ctdd-max", "st-biasdrop",
+  "st-attempt", "st-empty", "st-ctdd", "st-success", "st-ctdd-max", "st-biasdrop", "st-local",
   "ovflw-push", "ovflw-max"
 };
 
@@ -103,6 +103,9 @@ void TaskQueueStats::verify() const
   assert(get(steal_success) <= get(steal_attempt),
          "steal_success=%zu steal_attempt=%zu",
          get(steal_success), get(steal_attempt));
+  assert(get(steal_local) <= get(steal_success),
+         "steal_local=%zu steal_success=%zu",
+         get(steal_local), get(steal_success));
   assert(get(steal_empty) + get(steal_contended) + get(steal_success) == get(steal_attempt),
          "steal_empty=%zu steal_contended=%zu steal_success=%zu steal_attempt=%zu",
          get(steal_empty), get(steal_contended), get(steal_success), get(steal_attempt));
@@ -61,6 +61,7 @@ class TaskQueueStats {
     steal_success,    // number of successful steals
     steal_max_contended_in_a_row, // maximum number of contended steals in a row
     steal_bias_drop,  // number of times the bias has been dropped
+    steal_local,      // subset of successful steals from a queue on the same NUMA node
     overflow,         // number of overflow pushes
     overflow_max_len, // max length of overflow stack
     last_stat_id
@@ -82,6 +83,7 @@ class TaskQueueStats {
     }
   }
   inline void record_bias_drop() { ++_stats[steal_bias_drop]; }
+  inline void record_local_steal() { ++_stats[steal_local]; }
   inline void record_overflow(size_t new_length);
 
   TaskQueueStats & operator +=(const TaskQueueStats & addend);
@@ -396,7 +398,12 @@ class GenericTaskQueue: public TaskQueueSuper<N, F> {
   // Element array.
   E* _elems;
 
-  DEFINE_PAD_MINUS_SIZE(1, DEFAULT_PADDING_SIZE, sizeof(E*));
+  // The NUMA node the owner ran on at the start of the current task, or
+  // UnknownNumaNode. Only maintained with UseNUMA. Written by the owner,
+  // read by stealing threads.
+  volatile int _numa_node;
+
+  DEFINE_PAD_MINUS_SIZE(1, DEFAULT_PADDING_SIZE, sizeof(E*) + sizeof(int));
   // Queue owner local variables. Not to be accessed by other threads.
 
   static const uint InvalidQueueId = uint(-1);
@@ -406,8 +413,13 @@ class GenericTaskQueue: public TaskQueueSuper<N, F> {
 
   DEFINE_PAD_MINUS_SIZE(2, DEFAULT_PADDING_SIZE, sizeof(uint) + sizeof(int));
 public:
+  static const int UnknownNumaNode = -1;
+
   int next_random_queue_id();
 
+  int numa_node() const          { return Atomic::load(&_numa_node); }
+  void set_numa_node(int node)   { Atomic::store(&_numa_node, node); }
+
   void set_last_stolen_queue_id(uint id)     { _last_stolen_queue_id = id; }
   uint last_stolen_queue_id() const          { return _last_stolen_queue_id; }
   bool is_last_stolen_queue_id_valid() const { return _last_stolen_queue_id != InvalidQueueId; }
@@ -485,6 +497,17 @@ class GenericTaskQueueSet: public TaskQueueSetSuperImpl<F> {
   // as for the last pop_global() operation.
   PopResult steal_best_of_2(uint queue_num, E& t);
 
+  // Maximum number of queues steal_same_node() looks at per attempt, to keep
+  // the cost of a steal independent of the number of workers.
+  static const uint SameNodeScanLimit = 8;
+
+  // Like steal_best_of_2(), but only considers queues whose owner ran on the
+  // same NUMA node as the owner of queue_num, picking the fullest of at most
+  // SameNodeScanLimit queues starting at a random one.
+  PopResult steal_same_node(uint queue_num, E& t);
+
+  TASKQUEUE_STATS_ONLY(void record_steal_locality(uint queue_num, uint victim);)
+
 public:
   GenericTaskQueueSet(uint n);
   ~GenericTaskQueueSet();
@@ -495,6 +518,11 @@ class GenericTaskQueueSet: public TaskQueueSetSuperImpl<F> {
 
   T* queue(uint n);
 
+  // Record the NUMA node of the calling thread for the i'th queue, which must
+  // be owned by it. Called once at the start of a task; steal() then prefers
+  // victims on the same node. Does nothing without UseNUMA.
+  inline void update_numa_node(uint i);
+
   // Try to steal a task from some other queue than queue_num. It may perform several attempts at doing so.
   // Returns if stealing succeeds, and sets "t" to the stolen task.
   bool steal(uint queue_num, E& t);
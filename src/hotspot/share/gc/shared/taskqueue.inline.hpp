@@ -33,7 +33,9 @@
 #include "memory/resourceArea.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/atomic.hpp"
+#include "runtime/globals.hpp"
 #include "runtime/orderAccess.hpp"
+#include "runtime/os.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/ostream.hpp"
 #include "utilities/stack.inline.hpp"
@@ -52,6 +54,13 @@ inline GenericTaskQueueSet<T, F>::~GenericTaskQueueSet() {
   FREE_C_HEAP_ARRAY(T*, _queues);
 }
 
+template <class T, MEMFLAGS F>
+inline void GenericTaskQueueSet<T, F>::update_numa_node(uint i) {
+  if (UseNUMA) {
+    queue(i)->set_numa_node(os::numa_get_group_id());
+  }
+}
+
 #if TASKQUEUE_STATS
 template<class T, MEMFLAGS F>
 void GenericTaskQueueSet<T, F>::print_taskqueue_stats_hdr(outputStream* const st, const char* label) {
@@ -100,6 +109,7 @@ inline void GenericTaskQueueSet<T, F>::print_and_reset_taskqueue_stats(const cha
 template<class E, MEMFLAGS F, unsigned int N>
 inline GenericTaskQueue<E, F, N>::GenericTaskQueue() :
   _elems(MallocArrayAllocator<E>::allocate(N, F)),
+  _numa_node(UnknownNumaNode),
   _last_stolen_queue_id(InvalidQueueId),
   _seed(17 /* random number */) {}
 
@@ -353,6 +363,7 @@ typename GenericTaskQueueSet<T, F>::PopResult GenericTaskQueueSet<T, F>::steal_b
     }
 
     if (suc == PopResult::Success) {
+      TASKQUEUE_STATS_ONLY(record_steal_locality(queue_num, sel_k);)
       local_queue->set_last_stolen_queue_id(sel_k);
     } else {
       local_queue->invalidate_last_stolen_queue_id();
@@ -372,11 +383,79 @@ typename GenericTaskQueueSet<T, F>::PopResult GenericTaskQueueSet<T, F>::steal_b
   }
 }
 
+template<class T, MEMFLAGS F>
+typename GenericTaskQueueSet<T, F>::PopResult GenericTaskQueueSet<T, F>::steal_same_node(uint queue_num, E& t) {
+  T* const local_queue = queue(queue_num);
+  const int node = local_queue->numa_node();
+  assert(node != T::UnknownNumaNode, "must be known");
+
+  // Start the scan at a random queue so that thieves spread over the victims.
+  const uint start = local_queue->next_random_queue_id() % _n;
+  const uint limit = MIN2(_n, SameNodeScanLimit);
+  uint sel_k = queue_num;
+  uint sel_sz = 0;
+  for (uint i = 0; i < limit; i++) {
+    const uint k = (start + i) % _n;
+    if (k == queue_num || queue(k)->numa_node() != node) {
+      continue;
+    }
+    const uint sz = queue(k)->size();
+    if (sz > sel_sz) {
+      sel_k = k;
+      sel_sz = sz;
+    }
+  }
+
+  if (sel_sz == 0) {
+    // No work on this node.
+    return PopResult::Empty;
+  }
+
+  PopResult suc = queue(sel_k)->pop_global(t);
+  TASKQUEUE_STATS_ONLY(local_queue->record_steal_attempt(suc);)
+  if (suc == PopResult::Success) {
+    TASKQUEUE_STATS_ONLY(local_queue->stats.record_local_steal();)
+    local_queue->set_last_stolen_queue_id(sel_k);
+  }
+  return suc;
+}
+
+#if TASKQUEUE_STATS
+template<class T, MEMFLAGS F>
+void GenericTaskQueueSet<T, F>::record_steal_locality(uint queue_num, uint victim) {
+  const int node = queue(queue_num)->numa_node();
+  if (node != T::UnknownNumaNode && node == queue(victim)->numa_node()) {
+    queue(queue_num)->stats.record_local_steal();
+  }
+}
+#endif // TASKQUEUE_STATS
+
 template<class T, MEMFLAGS F>
 bool GenericTaskQueueSet<T, F>::steal(uint queue_num, E& t) {
   uint const num_retries = 2 * _n;
 
   TASKQUEUE_STATS_ONLY(uint contended_in_a_row = 0;)
+
+  if (UseNUMA && _n > 2) {
+    // Prefer victims on our own node, and only go remote once the queues
+    // steal_same_node() looks at have no more work.
+    T* const local_queue = queue(queue_num);
+    if (local_queue->numa_node() != T::UnknownNumaNode) {
+      for (uint i = 0; i < _n; i++) {
+        PopResult sr = steal_same_node(queue_num, t);
+        if (sr == PopResult::Success) {
+          return true;
+        } else if (sr == PopResult::Empty) {
+          break;
+        }
+        TASKQUEUE_STATS_ONLY(
+          contended_in_a_row++;
+          local_queue->stats.record_contended_in_a_row(contended_in_a_row);
+        )
+      }
+    }
+  }
+
   for (uint i = 0; i < num_retries; i++) {
     PopResult sr = steal_best_of_2(queue_num, t);
     if (sr == PopResult::Success) {
@@ -85,10 +85,10 @@ void ThreadLocalAllocBuffer::accumulate_and_reset_statistics(ThreadLocalAllocSta
 
   print_stats("gc");
 
-  if (_number_of_refills > 0) {
-    // Update allocation history if a reasonable amount of eden was allocated.
-    bool update_allocation_history = used > 0.5 * capacity;
+  // Update allocation history if a reasonable amount of eden was allocated.
+  bool update_allocation_history = used > 0.5 * capacity;
 
+  if (_number_of_refills > 0) {
     if (update_allocation_history) {
       // Average the fraction of eden allocated in a tlab by this
       // thread for use in the next resize operation.
@@ -109,6 +109,17 @@ void ThreadLocalAllocBuffer::accumulate_and_reset_statistics(ThreadLocalAllocSta
   } else {
     assert(_number_of_refills == 0 && _refill_waste == 0 && _gc_waste == 0,
            "tlab stats == 0");
+
+    if (update_allocation_history) {
+      // The thread did not refill its TLAB since the last GC. Sample what it
+      // did allocate (usually nothing) so that the desired size of idle
+      // threads decays, instead of keeping the size from the last time they
+      // were busy. Eden waste from many idle threads with large TLABs makes
+      // GCs more frequent.
+      float alloc_frac = MIN2(1.0f, allocated_since_last_gc / (float) used);
+      _allocation_fraction.sample(alloc_frac);
+      stats->update_idle_threads();
+    }
   }
 
   stats->update_slow_allocations(_slow_allocations);
@@ -381,6 +392,7 @@ void ThreadLocalAllocStats::initialize() {
 
 ThreadLocalAllocStats::ThreadLocalAllocStats() :
     _allocating_threads(0),
+    _idle_threads(0),
     _total_refills(0),
     _max_refills(0),
     _total_allocations(0),
@@ -409,6 +421,10 @@ void ThreadLocalAllocStats::update_fast_allocations(unsigned int refills,
   _max_refill_waste         = MAX2(_max_refill_waste, refill_waste);
 }
 
+void ThreadLocalAllocStats::update_idle_threads() {
+  _idle_threads += 1;
+}
+
 void ThreadLocalAllocStats::update_slow_allocations(unsigned int allocations) {
   _total_slow_allocations += allocations;
   _max_slow_allocations    = MAX2(_max_slow_allocations, allocations);
@@ -416,6 +432,7 @@ void ThreadLocalAllocStats::update_slow_allocations(unsigned int allocations) {
 
 void ThreadLocalAllocStats::update(const ThreadLocalAllocStats& other) {
   _allocating_threads      += other._allocating_threads;
+  _idle_threads            += other._idle_threads;
   _total_refills           += other._total_refills;
   _max_refills              = MAX2(_max_refills, other._max_refills);
   _total_allocations       += other._total_allocations;
@@ -429,6 +446,7 @@ void ThreadLocalAllocStats::update(const ThreadLocalAllocStats& other) {
 
 void ThreadLocalAllocStats::reset() {
   _allocating_threads      = 0;
+  _idle_threads            = 0;
   _total_refills           = 0;
   _max_refills             = 0;
   _total_allocations       = 0;
@@ -449,11 +467,11 @@ void ThreadLocalAllocStats::publish() {
 
   const size_t waste = _total_gc_waste + _total_refill_waste;
   const double waste_percent = percent_of(waste, _total_allocations);
-  log_debug(gc, tlab)("TLAB totals: thrds: %d  refills: %d max: %d"
+  log_debug(gc, tlab)("TLAB totals: thrds: %d idle: %d  refills: %d max: %d"
                       " slow allocs: %d max %d waste: %4.1f%%"
                       " gc: " SIZE_FORMAT "B max: " SIZE_FORMAT "B"
                       " slow: " SIZE_FORMAT "B max: " SIZE_FORMAT "B",
-                      _allocating_threads, _total_refills, _max_refills,
+                      _allocating_threads, _idle_threads, _total_refills, _max_refills,
                       _total_slow_allocations, _max_slow_allocations, waste_percent,
                       _total_gc_waste * HeapWordSize, _max_gc_waste * HeapWordSize,
                       _total_refill_waste * HeapWordSize, _max_refill_waste * HeapWordSize);
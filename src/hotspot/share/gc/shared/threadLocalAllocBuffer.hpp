@@ -203,6 +203,7 @@ class ThreadLocalAllocStats : public StackObj {
   static AdaptiveWeightedAverage _allocating_threads_avg;
 
   unsigned int _allocating_threads;
+  unsigned int _idle_threads;
   unsigned int _total_refills;
   unsigned int _max_refills;
   size_t       _total_allocations;
@@ -223,6 +224,7 @@ class ThreadLocalAllocStats : public StackObj {
                                size_t allocations,
                                size_t gc_waste,
                                size_t refill_waste);
+  void update_idle_threads();
   void update_slow_allocations(unsigned int allocations);
   void update(const ThreadLocalAllocStats& other);
 
@@ -34,11 +34,15 @@
 
 void ShenandoahLock::contended_lock(bool allow_block_for_safepoint) {
   Thread* thread = Thread::current();
+  const jlong start = os::elapsed_counter();
   if (allow_block_for_safepoint && thread->is_Java_thread()) {
     contended_lock_internal<true>(JavaThread::cast(thread));
   } else {
     contended_lock_internal<false>(nullptr);
   }
+  // We hold the lock now, but the counters are also read without it.
+  Atomic::add(&_contended_ticks, os::elapsed_counter() - start, memory_order_relaxed);
+  Atomic::inc(&_contended_count, memory_order_relaxed);
 }
 
 template<bool ALLOW_BLOCK>
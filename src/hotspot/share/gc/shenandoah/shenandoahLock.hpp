@@ -39,11 +39,15 @@ class ShenandoahLock  {
   shenandoah_padding(1);
   Thread* volatile _owner;
   shenandoah_padding(2);
+  // Contention statistics, only updated on the contended path
+  volatile size_t _contended_count;
+  volatile jlong _contended_ticks;
+  shenandoah_padding(3);
 
   template<bool ALLOW_BLOCK>
   void contended_lock_internal(JavaThread* java_thread);
 public:
-  ShenandoahLock() : _state(unlocked), _owner(nullptr) {};
+  ShenandoahLock() : _state(unlocked), _owner(nullptr), _contended_count(0), _contended_ticks(0) {};
 
   void lock(bool allow_block_for_safepoint) {
     assert(Atomic::load(&_owner) != Thread::current(), "reentrant locking attempt, would deadlock");
@@ -70,6 +74,11 @@ class ShenandoahLock  {
 
   void contended_lock(bool allow_block_for_safepoint);
 
+  // Number of acquisitions that missed the fast path, and the total time
+  // (in os::elapsed_counter() ticks) spent waiting in them.
+  size_t contended_count() const { return Atomic::load(&_contended_count); }
+  jlong contended_ticks() const  { return Atomic::load(&_contended_ticks); }
+
   bool owned_by_self() {
 #ifdef ASSERT
     return _state == locked && _owner == Thread::current();
@@ -30,6 +30,8 @@
 #include "gc/shenandoah/shenandoahHeap.inline.hpp"
 #include "gc/shenandoah/shenandoahHeapRegionCounters.hpp"
 #include "memory/metaspaceCounters.hpp"
+#include "memory/resourceArea.hpp"
+#include "runtime/perfData.inline.hpp"
 #include "services/memoryService.hpp"
 
 class ShenandoahYoungGenerationCounters : public GenerationCounters {
@@ -59,7 +61,9 @@ class ShenandoahGenerationCounters : public GenerationCounters {
 ShenandoahMonitoringSupport::ShenandoahMonitoringSupport(ShenandoahHeap* heap) :
         _partial_counters(nullptr),
         _full_counters(nullptr),
-        _counters_update_task(this)
+        _counters_update_task(this),
+        _heap_lock_contended_count(nullptr),
+        _heap_lock_contended_time(nullptr)
 {
   // Collection counters do not fit Shenandoah very well.
   // We record partial cycles as "young", and full cycles (including full STW GC) as "old".
@@ -73,9 +77,25 @@ ShenandoahMonitoringSupport::ShenandoahMonitoringSupport(ShenandoahHeap* heap) :
 
   _heap_region_counters = new ShenandoahHeapRegionCounters();
 
+  initialize_heap_lock_counters();
+
   _counters_update_task.enroll();
 }
 
+void ShenandoahMonitoringSupport::initialize_heap_lock_counters() {
+  if (UsePerfData) {
+    EXCEPTION_MARK;
+    ResourceMark rm;
+    const char* ns = PerfDataManager::name_space("shenandoah", "heapLock");
+
+    const char* cname = PerfDataManager::counter_name(ns, "contended");
+    _heap_lock_contended_count = PerfDataManager::create_long_variable(SUN_GC, cname, PerfData::U_Events, CHECK);
+
+    cname = PerfDataManager::counter_name(ns, "contendedTime");
+    _heap_lock_contended_time = PerfDataManager::create_long_variable(SUN_GC, cname, PerfData::U_Ticks, CHECK);
+  }
+}
+
 CollectorCounters* ShenandoahMonitoringSupport::stw_collection_counters() {
   return _full_counters;
 }
@@ -103,6 +123,10 @@ void ShenandoahMonitoringSupport::update_counters() {
     _space_counters->update_all(capacity, used);
     _heap_region_counters->update();
 
+    ShenandoahHeapLock* lock = heap->lock();
+    _heap_lock_contended_count->set_value((jlong)lock->contended_count());
+    _heap_lock_contended_time->set_value(lock->contended_ticks());
+
     MetaspaceCounters::update_performance_counters();
   }
 }
@@ -31,6 +31,7 @@
 
 class GenerationCounters;
 class HSpaceCounters;
+class PerfLongVariable;
 class ShenandoahHeap;
 class CollectorCounters;
 class ShenandoahHeapRegionCounters;
@@ -68,6 +69,11 @@ class ShenandoahMonitoringSupport : public CHeapObj<mtGC> {
   ShenandoahHeapRegionCounters* _heap_region_counters;
   ShenandoahPeriodicCountersUpdateTask _counters_update_task;
 
+  PerfLongVariable* _heap_lock_contended_count;
+  PerfLongVariable* _heap_lock_contended_time;
+
+  void initialize_heap_lock_counters();
+
 public:
   explicit ShenandoahMonitoringSupport(ShenandoahHeap* heap);
   CollectorCounters* stw_collection_counters();
@@ -26,6 +26,7 @@
 #include "gc/shared/suspendibleThreadSet.hpp"
 #include "gc/x/xArray.inline.hpp"
 #include "gc/x/xCollectedHeap.hpp"
+#include "gc/x/xCPU.inline.hpp"
 #include "gc/x/xFuture.inline.hpp"
 #include "gc/x/xGlobals.hpp"
 #include "gc/x/xLock.inline.hpp"
@@ -481,7 +482,7 @@ bool XPageAllocator::alloc_page_stall(XPageAllocation* allocation) {
   }
 
   // Send event
-  event.commit(allocation->type(), allocation->size());
+  event.commit(allocation->type(), allocation->size(), XCPU::id());
 
   return (result == XPageAllocationStallSuccess);
 }
@@ -25,6 +25,7 @@
 #include "gc/shared/gcLogPrecious.hpp"
 #include "gc/shared/suspendibleThreadSet.hpp"
 #include "gc/z/zArray.inline.hpp"
+#include "gc/z/zCPU.inline.hpp"
 #include "gc/z/zDriver.hpp"
 #include "gc/z/zFuture.inline.hpp"
 #include "gc/z/zGeneration.inline.hpp"
@@ -51,8 +52,12 @@
 
 static const ZStatCounter       ZCounterMutatorAllocationRate("Memory", "Allocation Rate", ZStatUnitBytesPerSecond);
 static const ZStatCounter       ZCounterPageCacheFlush("Memory", "Page Cache Flush", ZStatUnitBytesPerSecond);
+static const ZStatCounter       ZCounterPageCacheMerge("Memory", "Page Cache Merge", ZStatUnitBytesPerSecond);
 static const ZStatCounter       ZCounterDefragment("Memory", "Defragment", ZStatUnitOpsPerSecond);
 static const ZStatCriticalPhase ZCriticalPhaseAllocationStall("Allocation Stall");
+static const ZStatSampler       ZSamplerAllocationStallSmall("Memory", "Allocation Stall Small", ZStatUnitTime);
+static const ZStatSampler       ZSamplerAllocationStallMedium("Memory", "Allocation Stall Medium", ZStatUnitTime);
+static const ZStatSampler       ZSamplerAllocationStallLarge("Memory", "Allocation Stall Large", ZStatUnitTime);
 
 ZSafePageRecycle::ZSafePageRecycle(ZPageAllocator* page_allocator)
   : _page_allocator(page_allocator),
@@ -518,8 +523,24 @@ static void check_out_of_memory_during_initialization() {
   }
 }
 
+static const ZStatSampler& allocation_stall_sampler(ZPageType type) {
+  switch (type) {
+  case ZPageType::small:
+    return ZSamplerAllocationStallSmall;
+
+  case ZPageType::medium:
+    return ZSamplerAllocationStallMedium;
+
+  default:
+    assert(type == ZPageType::large, "Invalid page type");
+    return ZSamplerAllocationStallLarge;
+  }
+}
+
 bool ZPageAllocator::alloc_page_stall(ZPageAllocation* allocation) {
-  ZStatTimer timer(ZCriticalPhaseAllocationStall);
+  // Sample stall time also per page type, to tell apart stalls for small
+  // allocations from stalls for medium and large allocations
+  ZStatTimer timer(ZCriticalPhaseAllocationStall, allocation_stall_sampler(allocation->type()));
   EventZAllocationStall event;
 
   // We can only block if the VM is fully initialized
@@ -544,7 +565,7 @@ bool ZPageAllocator::alloc_page_stall(ZPageAllocation* allocation) {
   }
 
   // Send event
-  event.commit((u8)allocation->type(), allocation->size());
+  event.commit((u8)allocation->type(), allocation->size(), ZCPU::id());
 
   return result;
 }
@@ -572,6 +593,110 @@ bool ZPageAllocator::alloc_page_or_stall(ZPageAllocation* allocation) {
   return alloc_page_stall(allocation);
 }
 
+static int page_start_compare(ZPage** a, ZPage** b) {
+  const zoffset start_a = (*a)->start();
+  const zoffset start_b = (*b)->start();
+  if (start_a < start_b) {
+    return -1;
+  } else if (start_a > start_b) {
+    return 1;
+  }
+  return 0;
+}
+
+bool ZPageAllocator::is_mergeable(const ZVirtualMemory& prev_vmem, const ZPhysicalMemory& prev_pmem,
+                                  const ZVirtualMemory& next_vmem, const ZPhysicalMemory& next_pmem) {
+  if (prev_vmem.end() != next_vmem.start()) {
+    // Not virtually contiguous
+    return false;
+  }
+
+  if (next_pmem.segment(0).start() < prev_pmem.segment(prev_pmem.nsegments() - 1).end()) {
+    // Physical memory would not be mapped in address order
+    return false;
+  }
+
+  return true;
+}
+
+ZPage* ZPageAllocator::alloc_page_merge(ZPageAllocation* allocation) {
+  // If the flushed pages exactly cover the requested size, are virtually
+  // contiguous, and their physical memory is laid out in address order,
+  // they can be merged into a single page that keeps the existing virtual
+  // memory and mappings. This avoids the unmap/map round trip, and keeps
+  // any large pages backing the memory intact.
+  ZList<ZPage>* const pages = allocation->pages();
+  if (pages->size() < 2) {
+    // Nothing to merge
+    return nullptr;
+  }
+
+  // Medium and large pages are allocated in the high half of the address
+  // space, and small pages in the low half. Only merge pages that already
+  // live where ZVirtualMemoryManager::alloc would place the merged page,
+  // so that merging never leaves a medium or large page among the small
+  // pages. This is typically the case for small pages split from a medium
+  // or large page, which get merged back.
+  if (allocation->type() == ZPageType::small) {
+    // Only medium and large pages are merged
+    return nullptr;
+  }
+
+  const zoffset high_half_start = to_zoffset(_virtual.reserved() / 2);
+
+  ZArray<ZPage*> sorted(checked_cast<int>(pages->size()));
+  size_t flushed = 0;
+
+  ZListIterator<ZPage> iter(pages);
+  for (ZPage* page; iter.next(&page);) {
+    if (page->start() < high_half_start) {
+      // Not in the medium/large page address range
+      return nullptr;
+    }
+    sorted.append(page);
+    flushed += page->size();
+  }
+
+  if (flushed != allocation->size()) {
+    // Need to commit more memory
+    return nullptr;
+  }
+
+  sorted.sort(page_start_compare);
+
+  for (int i = 1; i < sorted.length(); i++) {
+    const ZPage* const prev = sorted.at(i - 1);
+    const ZPage* const next = sorted.at(i);
+    if (!is_mergeable(prev->virtual_memory(), prev->physical_memory(),
+                      next->virtual_memory(), next->physical_memory())) {
+      return nullptr;
+    }
+  }
+
+  const ZVirtualMemory vmem(sorted.first()->start(), flushed);
+  ZPhysicalMemory pmem;
+
+  for (int i = 0; i < sorted.length(); i++) {
+    ZPage* const page = sorted.at(i);
+    pages->remove(page);
+
+    // Harvest flushed physical memory, the mapping is left untouched
+    ZPhysicalMemory& fmem = page->physical_memory();
+    pmem.add_segments(fmem);
+    fmem.remove_segments();
+
+    safe_destroy_page(page);
+  }
+
+  allocation->set_flushed(flushed);
+
+  // Update statistics
+  ZStatInc(ZCounterPageCacheMerge, flushed);
+  log_debug(gc, heap)("Page Cache Merged: " SIZE_FORMAT "M", flushed / M);
+
+  return new ZPage(allocation->type(), vmem, pmem);
+}
+
 ZPage* ZPageAllocator::alloc_page_create(ZPageAllocation* allocation) {
   const size_t size = allocation->size();
 
@@ -668,6 +793,12 @@ ZPage* ZPageAllocator::alloc_page_finalize(ZPageAllocation* allocation) {
     return allocation->pages()->remove_first();
   }
 
+  // Medium path, merge contiguous already mapped pages
+  ZPage* const merged_page = alloc_page_merge(allocation);
+  if (merged_page != nullptr) {
+    return merged_page;
+  }
+
   // Slow path
   ZPage* const page = alloc_page_create(allocation);
   if (page == nullptr) {
@@ -112,6 +112,7 @@ class ZPageAllocator {
   bool alloc_page_or_stall(ZPageAllocation* allocation);
   bool should_defragment(const ZPage* page) const;
   bool is_alloc_satisfied(ZPageAllocation* allocation) const;
+  ZPage* alloc_page_merge(ZPageAllocation* allocation);
   ZPage* alloc_page_create(ZPageAllocation* allocation);
   ZPage* alloc_page_finalize(ZPageAllocation* allocation);
   void free_pages_alloc_failed(ZPageAllocation* allocation);
@@ -131,6 +132,11 @@ class ZPageAllocator {
 
   bool is_initialized() const;
 
+  // Returns true if a page with the given memory can be merged with the
+  // page directly following it, keeping the existing mapping.
+  static bool is_mergeable(const ZVirtualMemory& prev_vmem, const ZPhysicalMemory& prev_pmem,
+                           const ZVirtualMemory& next_vmem, const ZPhysicalMemory& next_pmem);
+
   bool prime_cache(ZWorkers* workers, size_t size);
 
   size_t initial_capacity() const;
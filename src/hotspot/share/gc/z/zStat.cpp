@@ -874,6 +874,16 @@ void ZStatCriticalPhase::register_end(ConcurrentGCTimer* timer, const Ticks& sta
   }
 }
 
+ZStatTimer::~ZStatTimer() {
+  const Ticks end = Ticks::now();
+  _phase.register_end(_gc_timer, _start, end);
+
+  if (_sampler != nullptr) {
+    const Tickspan duration = end - _start;
+    ZStatSample(*_sampler, duration.value());
+  }
+}
+
 ZStatTimerYoung::ZStatTimerYoung(const ZStatPhase& phase)
   : ZStatTimer(phase, ZGeneration::young()->gc_timer()) {}
 
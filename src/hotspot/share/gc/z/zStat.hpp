@@ -300,14 +300,16 @@ class ZStatCriticalPhase : public ZStatPhase {
 //
 class ZStatTimer : public StackObj {
 private:
-  ConcurrentGCTimer* const _gc_timer;
-  const ZStatPhase&        _phase;
-  const Ticks              _start;
+  ConcurrentGCTimer* const  _gc_timer;
+  const ZStatPhase&         _phase;
+  const ZStatSampler* const _sampler;
+  const Ticks               _start;
 
 public:
   ZStatTimer(const ZStatPhase& phase, ConcurrentGCTimer* gc_timer)
     : _gc_timer(gc_timer),
       _phase(phase),
+      _sampler(nullptr),
       _start(Ticks::now()) {
     _phase.register_start(_gc_timer, _start);
   }
@@ -320,10 +322,16 @@ class ZStatTimer : public StackObj {
     : ZStatTimer(phase, nullptr /* timer */) {
   }
 
-  ~ZStatTimer() {
-    const Ticks end = Ticks::now();
-    _phase.register_end(_gc_timer, _start, end);
+  // Also samples the phase duration into the given sampler
+  ZStatTimer(const ZStatCriticalPhase& phase, const ZStatSampler& sampler)
+    : _gc_timer(nullptr),
+      _phase(phase),
+      _sampler(&sampler),
+      _start(Ticks::now()) {
+    _phase.register_start(_gc_timer, _start);
   }
+
+  ~ZStatTimer();
 };
 
 class ZStatTimerYoung : public ZStatTimer {
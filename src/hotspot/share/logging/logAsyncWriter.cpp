@@ -81,8 +81,12 @@ void AsyncLogWriter::enqueue_locked(LogFileStreamOutput* output, const LogDecora
     return;
   }
 
-  _data_available = true;
-  _lock.notify();
+  // The writer thread only waits while no data is available, so only the
+  // message that makes data available has to wake it up.
+  if (!_data_available) {
+    _data_available = true;
+    _lock.notify();
+  }
 }
 
 void AsyncLogWriter::enqueue(LogFileStreamOutput& output, const LogDecorations& decorations, const char* msg) {
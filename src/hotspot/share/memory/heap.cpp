@@ -41,6 +41,7 @@ CodeHeap::CodeHeap(const char* name, const CodeBlobType code_blob_type)
   _number_of_reserved_segments  = 0;
   _segment_size                 = 0;
   _log2_segment_size            = 0;
+  _commit_granularity           = 0;
   _next_segment                 = 0;
   _freelist                     = nullptr;
   _last_insert_point            = nullptr;
@@ -198,7 +199,7 @@ void CodeHeap::on_code_mapping(char* base, size_t size) {
 }
 
 
-bool CodeHeap::reserve(ReservedSpace rs, size_t committed_size, size_t segment_size) {
+bool CodeHeap::reserve(ReservedSpace rs, size_t committed_size, size_t segment_size, bool use_large_pages) {
   assert(rs.size() >= committed_size, "reserved < committed");
   assert(segment_size >= sizeof(FreeBlock), "segment size is too small");
   assert(is_power_of_2(segment_size), "segment_size must be a power of 2");
@@ -213,8 +214,15 @@ bool CodeHeap::reserve(ReservedSpace rs, size_t committed_size, size_t segment_s
   const size_t c_size = align_up(committed_size, page_size);
   assert(c_size <= rs.size(), "alignment made committed size to large");
 
+  // Commits aligned to a large page granularity are advised to use
+  // transparent huge pages; committing at small page granularity avoids that.
+  _commit_granularity = os::page_size_for_region_unaligned(rs.size(), 1);
+  if (!use_large_pages && !rs.special()) {
+    _commit_granularity = os::vm_page_size();
+  }
+
   os::trace_page_sizes(_name, c_size, rs.size(), rs.base(), rs.size(), page_size);
-  if (!_memory.initialize(rs, c_size)) {
+  if (!_memory.initialize_with_granularity(rs, c_size, _commit_granularity)) {
     return false;
   }
 
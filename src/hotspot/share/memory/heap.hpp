@@ -91,6 +91,7 @@ class CodeHeap : public CHeapObj<mtCode> {
   size_t       _number_of_reserved_segments;
   size_t       _segment_size;
   int          _log2_segment_size;
+  size_t       _commit_granularity;              // granularity _memory is committed at
 
   size_t       _next_segment;
 
@@ -151,7 +152,9 @@ class CodeHeap : public CHeapObj<mtCode> {
   CodeHeap(const char* name, const CodeBlobType code_blob_type);
 
   // Heap extents
-  bool  reserve(ReservedSpace rs, size_t committed_size, size_t segment_size);
+  // If use_large_pages is false, committed memory is not advised to be backed
+  // by transparent huge pages. Explicit large pages (rs.special()) are kept.
+  bool  reserve(ReservedSpace rs, size_t committed_size, size_t segment_size, bool use_large_pages = true);
   bool  expand_by(size_t size);                  // expands committed memory by size
 
   // Memory allocation
@@ -170,6 +173,9 @@ class CodeHeap : public CHeapObj<mtCode> {
   // Boundaries of reserved space.
   char* low_boundary() const                     { return _memory.low_boundary(); }
   char* high_boundary() const                    { return _memory.high_boundary(); }
+  // Granularity the space is committed at. This is not necessarily the page
+  // size backing it, e.g. with transparent huge pages in mode "always".
+  size_t commit_granularity() const              { return _commit_granularity; }
 
   // Containment means "contained in committed space".
   bool contains(const void* p) const             { return low() <= p && p < high(); }
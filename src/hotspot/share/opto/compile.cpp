@@ -629,6 +629,7 @@ Compile::Compile( ciEnv* ci_env, ciMethod* target, int osr_bci,
                   _inlining_incrementally(false),
                   _do_cleanup(false),
                   _has_reserved_stack_access(target->has_reserved_stack_access()),
+                  _has_scoped_access(target->is_scoped()),
 #ifndef PRODUCT
                   _igv_idx(0),
                   _trace_opto_output(directive->TraceOptoOutputOption),
@@ -909,6 +910,7 @@ Compile::Compile( ciEnv* ci_env,
     _inlining_progress(false),
     _inlining_incrementally(false),
     _has_reserved_stack_access(false),
+    _has_scoped_access(false),
 #ifndef PRODUCT
     _igv_idx(0),
     _trace_opto_output(directive->TraceOptoOutputOption),
@@ -710,6 +710,12 @@ Node *PhaseIdealLoop::conditional_move( Node *region ) {
   assert(r_loop == get_loop(iff), "sanity");
   // Always convert to CMOVE if all results are used only outside this loop.
   bool used_inside_loop = (r_loop == _ltree_root);
+  // Float and double CMoves in an innermost counted loop are candidates for
+  // SuperWord, which turns Cmp + Bool + CMove into VectorMaskCmp + VectorBlend.
+  // Once vectorized, the branch profile is irrelevant, so treat them as if
+  // CMove was always profitable (like UseCMoveUnconditionally does).
+  const bool vector_cmove = UseVectorCmov && UseSuperWord && r_loop->is_counted() && r_loop->is_innermost();
+  bool fp_phis_only = true;
 
   // Check profitability
   int cost = 0;
@@ -723,21 +729,24 @@ Node *PhaseIdealLoop::conditional_move( Node *region ) {
     switch (bt) {
     case T_DOUBLE:
     case T_FLOAT:
-      if (C->use_cmove()) {
+      if (C->use_cmove() || vector_cmove) {
         continue; //TODO: maybe we want to add some cost
       }
       cost += Matcher::float_cmove_cost(); // Could be very expensive
       break;
     case T_LONG: {
+      fp_phis_only = false;
       cost += Matcher::long_cmove_cost(); // May encodes as 2 CMOV's
     }
     case T_INT:                 // These all CMOV fine
     case T_ADDRESS: {           // (RawPtr)
+      fp_phis_only = false;
       cost++;
       break;
     }
     case T_NARROWOOP: // Fall through
     case T_OBJECT: {            // Base oops are OK, but not derived oops
+      fp_phis_only = false;
       const TypeOopPtr *tp = phi->type()->make_ptr()->isa_oopptr();
       // Derived pointers are Bad (tm): what's the Base (for GC purposes) of a
       // CMOVE'd derived pointer?  It's a CMOVE'd derived base.  Thus
@@ -816,7 +825,7 @@ Node *PhaseIdealLoop::conditional_move( Node *region ) {
   }
   // Check for highly predictable branch.  No point in CMOV'ing if
   // we are going to predict accurately all the time.
-  if (C->use_cmove() && (cmp_op == Op_CmpF || cmp_op == Op_CmpD)) {
+  if ((C->use_cmove() || (vector_cmove && fp_phis_only)) && (cmp_op == Op_CmpF || cmp_op == Op_CmpD)) {
     //keep going
   } else if (iff->_prob < infrequent_prob ||
       iff->_prob > (1.0f - infrequent_prob))
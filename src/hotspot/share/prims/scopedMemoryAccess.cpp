@@ -24,6 +24,7 @@
 
 #include "precompiled.hpp"
 #include "classfile/vmSymbols.hpp"
+#include "code/nmethod.hpp"
 #include "jni.h"
 #include "jvm.h"
 #include "oops/access.inline.hpp"
@@ -116,10 +117,16 @@ class CloseScopedMemoryClosure : public HandshakeClosure {
 
     ResourceMark rm;
     if (last_frame.is_compiled_frame() && last_frame.can_be_deoptimized()) {
-      // FIXME: we would like to conditionally deoptimize only if the corresponding
-      // _session is reachable from the frame, but reachabilityFence doesn't currently
-      // work the way it should. Therefore we deopt unconditionally for now.
-      Deoptimization::deoptimize(jt, last_frame);
+      nmethod* code = last_frame.cb()->as_nmethod();
+      if (code->has_scoped_access()) {
+        // We would like to deoptimize here only if last_frame::oops_do
+        // reports the session oop being live at this safepoint, but this
+        // currently isn't possible due to limitations in the C2 liveness
+        // computation. So we make do with deoptimizing every compiled frame
+        // whose code inlines a scoped method. Code without scoped accesses
+        // cannot have hoisted a liveness check for the session.
+        Deoptimization::deoptimize(jt, last_frame);
+      }
     }
 
     if (jt->has_async_exception_condition()) {
@@ -1399,6 +1399,34 @@ void Arguments::set_use_compressed_oops() {
   // to use UseCompressedOops are InitialHeapSize and MinHeapSize.
   size_t max_heap_size = MAX3(MaxHeapSize, InitialHeapSize, MinHeapSize);
 
+  if (UseObjectAlignmentErgonomics &&
+      max_heap_size > max_heap_for_compressed_oops() &&
+      FLAG_IS_DEFAULT(ObjectAlignmentInBytes) &&
+      FLAG_IS_DEFAULT(UseCompressedOops) &&
+      !CDSConfig::is_dumping_archive() && !RequireSharedSpaces) {
+    // Doubling the object alignment doubles the heap range that compressed
+    // oops can address, at the cost of more padding per object. Since the
+    // compressed heap range is still checked below, this only changes
+    // anything if the larger alignment makes the heap fit.
+    const int saved_alignment = ObjectAlignmentInBytes;
+    FLAG_SET_ERGO(ObjectAlignmentInBytes, 16);
+    set_object_alignment();
+    if (max_heap_size <= max_heap_for_compressed_oops()) {
+      log_info(gc, heap, coops)("Using ObjectAlignmentInBytes=%d to keep compressed oops for a "
+                                SIZE_FORMAT "M max heap; objects may grow by up to %d bytes of padding each",
+                                ObjectAlignmentInBytes, max_heap_size / M,
+                                ObjectAlignmentInBytes - saved_alignment);
+      if (UseSharedSpaces) {
+        log_info(cds)("CDS archives created with ObjectAlignmentInBytes=%d, such as the default "
+                      "CDS archive, cannot be used with ObjectAlignmentInBytes=%d",
+                      saved_alignment, ObjectAlignmentInBytes);
+      }
+    } else {
+      FLAG_SET_DEFAULT(ObjectAlignmentInBytes, saved_alignment);
+      set_object_alignment();
+    }
+  }
+
   if (max_heap_size <= max_heap_for_compressed_oops()) {
     if (FLAG_IS_DEFAULT(UseCompressedOops)) {
       FLAG_SET_ERGO(UseCompressedOops, true);
@@ -40,6 +40,7 @@
 #include "interpreter/bytecodeStream.hpp"
 #include "interpreter/interpreter.hpp"
 #include "interpreter/oopMapCache.hpp"
+#include "jfr/jfrEvents.hpp"
 #include "jvm.h"
 #include "logging/log.hpp"
 #include "logging/logLevel.hpp"
@@ -98,7 +99,6 @@
 #include "utilities/preserveException.hpp"
 #include "utilities/xmlstream.hpp"
 #if INCLUDE_JFR
-#include "jfr/jfrEvents.hpp"
 #include "jfr/metadata/jfrSerializer.hpp"
 #endif
 
@@ -1036,16 +1036,36 @@ class DeoptimizeMarkedClosure : public HandshakeClosure {
 
 void Deoptimization::deoptimize_all_marked() {
   ResourceMark rm;
+  const bool at_safepoint = SafepointSynchronize::is_at_safepoint();
+  const Ticks start = Ticks::now();
 
   // Make the dependent methods not entrant
-  CodeCache::make_marked_nmethods_deoptimized();
+  const uint count = CodeCache::make_marked_nmethods_deoptimized();
+  const Ticks not_entrant_done = Ticks::now();
 
   DeoptimizeMarkedClosure deopt;
-  if (SafepointSynchronize::is_at_safepoint()) {
+  if (at_safepoint) {
     Threads::java_threads_do(&deopt);
   } else {
     Handshake::execute(&deopt);
   }
+  const Ticks end = Ticks::now();
+
+  log_debug(deoptimization)("Deoptimized %u marked methods: not entrant %.3fms, %s %.3fms",
+                            count,
+                            (not_entrant_done - start).seconds() * MILLIUNITS,
+                            at_safepoint ? "safepoint stack walk" : "handshake",
+                            (end - not_entrant_done).seconds() * MILLIUNITS);
+  EventDeoptimizationSummary event(UNTIMED);
+  if (event.should_commit()) {
+    event.set_starttime(start);
+    event.set_endtime(end);
+    event.set_methodCount(count);
+    event.set_notEntrantTime(not_entrant_done - start);
+    event.set_stackWalkTime(end - not_entrant_done);
+    event.set_atSafepoint(at_safepoint);
+    event.commit();
+  }
 }
 
 Deoptimization::DeoptAction Deoptimization::_unloaded_action
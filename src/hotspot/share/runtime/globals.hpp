@@ -131,7 +131,11 @@ const size_t minimumSymbolTableSize = 1024;
   product(int, ObjectAlignmentInBytes, 8,                                   \
           "Default object alignment in bytes, 8 is minimum")                \
           range(8, 256)                                                     \
-          constraint(ObjectAlignmentInBytesConstraintFunc, AtParse)
+          constraint(ObjectAlignmentInBytesConstraintFunc, AtParse)         \
+                                                                            \
+  product(bool, UseObjectAlignmentErgonomics, false, EXPERIMENTAL,          \
+          "Select 16-byte object alignment if the maximum heap size is "    \
+          "too large for compressed oops with the default alignment")
 
 #else
 // !_LP64
@@ -928,6 +932,11 @@ const int ObjectAlignmentInBytes = 8;
              "Reduce the number of parallel compiler threads when they "    \
              "are not used")                                                \
                                                                             \
+  product(uintx, DynamicCompilerThreadsQueueLatency, 0, DIAGNOSTIC,         \
+          "Add a compiler thread when the oldest queued compile task has "  \
+          "waited longer than this many milliseconds, even if the queue "   \
+          "is short. 0 means only queue length is considered")              \
+                                                                            \
   product(bool, TraceCompilerThreads, false, DIAGNOSTIC,                    \
              "Trace creation and removal of compiler threads")              \
                                                                             \
@@ -1534,6 +1543,11 @@ const int ObjectAlignmentInBytes = 8;
           "Size of code heap with profiled methods (in bytes)")             \
           range(0, max_uintx)                                               \
                                                                             \
+  product(bool, ProfiledCodeHeapLargePages, false, DIAGNOSTIC,              \
+          "Commit the profiled code heap in transparent huge pages when "   \
+          "UseTransparentHugePages is set. Profiled code is short-lived, "  \
+          "so by default only the other code heaps use them")               \
+                                                                            \
   product_pd(uintx, NonNMethodCodeHeapSize,                                 \
           "Size of code heap with non-nmethods (in bytes)")                 \
           constraint(VMPageSizeConstraintFunc, AtParse)                     \
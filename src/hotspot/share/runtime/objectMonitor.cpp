@@ -1904,6 +1904,20 @@ bool ObjectMonitor::short_fixed_spin(JavaThread* current, int spin_count, bool a
   return false;
 }
 
+// Returns true if the owner is a JavaThread that is blocked, so it is not
+// going to release the monitor soon and spinning on it is futile. With
+// LM_LEGACY the owner may be a BasicLock*, so the owner state is not used.
+// The owner may exit concurrently, so its state is read with SafeFetch32
+// and the result is only a hint.
+bool ObjectMonitor::owner_is_blocked(void* owner) {
+  if (LockingMode == LM_LEGACY || owner == nullptr ||
+      owner == anon_owner_ptr() || owner == DEFLATER_MARKER) {
+    return false;
+  }
+  int* state_addr = (int*)((address)owner + in_bytes(JavaThread::thread_state_offset()));
+  return SafeFetch32(state_addr, _thread_in_Java) == _thread_blocked;
+}
+
 // Spinning: Fixed frequency (100%), vary duration
 bool ObjectMonitor::TrySpin(JavaThread* current) {
 
@@ -1968,6 +1982,11 @@ bool ObjectMonitor::TrySpin(JavaThread* current) {
       if (SafepointMechanism::local_poll_armed(current)) {
         break;
       }
+      // Abort without prejudice if the owner itself is blocked: it will
+      // not release the monitor before it is woken up.
+      if (prv != nullptr && owner_is_blocked(prv)) {
+        break;
+      }
       SpinPause();
     }
 
@@ -361,6 +361,7 @@ class ObjectMonitor : public CHeapObj<mtObjectMonitor> {
 
   bool      TrySpin(JavaThread* current);
   bool      short_fixed_spin(JavaThread* current, int spin_count, bool adapt);
+  static bool owner_is_blocked(void* owner);
   void      ExitEpilog(JavaThread* current, ObjectWaiter* Wakee);
 
   // Deflation support
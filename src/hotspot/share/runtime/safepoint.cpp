@@ -36,6 +36,7 @@
 #include "gc/shared/workerUtils.hpp"
 #include "interpreter/interpreter.hpp"
 #include "jfr/jfrEvents.hpp"
+#include "jfr/support/jfrThreadId.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/resourceArea.hpp"
@@ -63,6 +64,7 @@
 #include "runtime/threadSMR.hpp"
 #include "runtime/threadWXSetters.inline.hpp"
 #include "runtime/timerTrace.hpp"
+#include "runtime/vframe.inline.hpp"
 #include "services/runtimeService.hpp"
 #include "utilities/events.hpp"
 #include "utilities/macros.hpp"
@@ -102,6 +104,46 @@ static void post_safepoint_end_event(EventSafepointEnd& event, uint64_t safepoin
   }
 }
 
+// Report the last thread that had to be waited for, and the Java frame it
+// stopped in. A thread stopping at a poll after a long-running loop points
+// at the code that delayed the safepoint.
+static void report_last_thread(JavaThread* thread, EventSafepointStraggler& event, uint64_t safepoint_id) {
+  LogTarget(Debug, safepoint) lt;
+  if (!lt.is_enabled() && !event.should_commit()) {
+    return;
+  }
+
+  const Method* method = nullptr;
+  int bci = -1;
+  if (thread->has_last_Java_frame()) {
+    // Only reads the top frame; no oops are accessed.
+    vframeStream vfst(thread, false /* stop_at_java_call_stub */, false /* process_frames */);
+    if (!vfst.at_end()) {
+      method = vfst.method();
+      bci = vfst.bci();
+    }
+  }
+
+  if (lt.is_enabled()) {
+    ResourceMark rm;
+    LogStream ls(lt);
+    ls.print("Last thread to reach safepoint: %s", thread->name());
+    if (method != nullptr) {
+      ls.print(" in %s @ %d", method->name_and_sig_as_C_string(), bci);
+    }
+    ls.cr();
+  }
+
+  if (event.should_commit()) {
+    event.set_safepointId(safepoint_id);
+    event.set_straggler(JFR_THREAD_ID(thread));
+    event.set_method(method);
+    event.set_bci(bci);
+    event.set_lineNumber(method != nullptr ? method->line_number_from_bci(bci) : -1);
+    event.commit();
+  }
+}
+
 // SafepointCheck
 SafepointStateTracker::SafepointStateTracker(uint64_t safepoint_id, bool at_safepoint)
   : _safepoint_id(safepoint_id), _at_safepoint(at_safepoint) {}
@@ -195,7 +237,8 @@ static void back_off(int64_t start_time) {
   }
 }
 
-int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int nof_threads, int* initial_running)
+int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int nof_threads, int* initial_running,
+                                              JavaThread** last_thread)
 {
   JavaThreadIteratorWithHandle jtiwh;
 
@@ -225,6 +268,7 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
   DEBUG_ONLY(assert_list_is_valid(tss_head, still_running);)
 
   *initial_running = still_running;
+  *last_thread = nullptr;
 
   // If there is no thread still running, we are already done.
   if (still_running <= 0) {
@@ -247,6 +291,7 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
       assert(cur_tss->is_running(), "Illegal initial state");
       if (thread_not_running(cur_tss)) {
         --still_running;
+        *last_thread = cur_tss->thread();
         *p_prev = nullptr;
         ThreadSafepointState *tmp = cur_tss;
         cur_tss = cur_tss->get_next();
@@ -364,13 +409,15 @@ void SafepointSynchronize::begin() {
   }
 
   EventSafepointStateSynchronization sync_event;
+  EventSafepointStraggler straggler_event;
   int initial_running = 0;
+  JavaThread* last_thread = nullptr;
 
   // Arms the safepoint, _current_jni_active_count and _waiting_to_block must be set before.
   arm_safepoint();
 
   // Will spin until all threads are safe.
-  int iterations = synchronize_threads(safepoint_limit_time, nof_threads, &initial_running);
+  int iterations = synchronize_threads(safepoint_limit_time, nof_threads, &initial_running, &last_thread);
   assert(_waiting_to_block == 0, "No thread should be running");
 
 #ifndef PRODUCT
@@ -419,6 +466,10 @@ void SafepointSynchronize::begin() {
 
   SafepointTracing::synchronized(nof_threads, initial_running, _nof_threads_hit_polling_page);
 
+  if (last_thread != nullptr) {
+    report_last_thread(last_thread, straggler_event, _safepoint_id);
+  }
+
   post_safepoint_begin_event(begin_event, _safepoint_id, nof_threads, _current_jni_active_count);
 }
 
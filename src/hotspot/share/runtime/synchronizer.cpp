@@ -1818,6 +1818,8 @@ size_t ObjectSynchronizer::deflate_idle_monitors() {
   _last_async_deflation_time_ns = os::javaTimeNanos();
   set_is_async_deflation_requested(false);
 
+  EventJavaMonitorDeflation event;
+  const size_t in_use_count = _in_use_list.count();
   ObjectMonitorDeflationLogging log;
   ObjectMonitorDeflationSafepointer safepointer(current, &log);
 
@@ -1858,6 +1860,13 @@ size_t ObjectSynchronizer::deflate_idle_monitors() {
 
   log.end(deflated_count, unlinked_count);
 
+  if (event.should_commit()) {
+    event.set_inUseCount(in_use_count);
+    event.set_deflatedCount(deflated_count);
+    event.set_unlinkedCount(unlinked_count);
+    event.commit();
+  }
+
   OM_PERFDATA_OP(MonExtant, set_value(_in_use_list.count()));
   OM_PERFDATA_OP(Deflations, inc(deflated_count));
 
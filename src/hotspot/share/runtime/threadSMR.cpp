@@ -104,6 +104,15 @@ uint64_t              ThreadsSMRSupport::_java_thread_list_free_cnt = 0;
 // Impl note: Max # of threads alive at one time should fit in unsigned 32-bit.
 uint                  ThreadsSMRSupport::_java_thread_list_max = 0;
 
+// Max time in micros to replace the _java_thread_list for a thread
+// create or exit, including the free_list() hazard pointer scan.
+// Impl note: Only updated with the Threads_lock held.
+uint                  ThreadsSMRSupport::_java_thread_list_update_time_max = 0;
+
+// Cumulative time in micros to replace the _java_thread_list.
+// Impl note: See _java_thread_list_update_time_max note.
+uint64_t              ThreadsSMRSupport::_java_thread_list_update_times = 0;
+
 // Max # of nested ThreadsLists for a thread.
 // Impl note: Hard to imagine > 64K nested ThreadsLists so this could be
 // 16-bit, but there is no nice 16-bit _FORMAT support.
@@ -176,6 +185,14 @@ inline void ThreadsSMRSupport::update_java_thread_list_max(uint new_value) {
   }
 }
 
+inline void ThreadsSMRSupport::update_java_thread_list_update_time(const elapsedTimer& timer) {
+  const uint micros = (uint)(timer.seconds() * MICROUNITS);
+  _java_thread_list_update_times += micros;
+  if (micros > _java_thread_list_update_time_max) {
+    _java_thread_list_update_time_max = micros;
+  }
+}
+
 inline ThreadsList* ThreadsSMRSupport::xchg_java_thread_list(ThreadsList* new_list) {
   return (ThreadsList*)Atomic::xchg(&_java_thread_list, new_list);
 }
@@ -854,6 +871,11 @@ FastThreadsListHandle::FastThreadsListHandle(oop thread_oop, JavaThread* java_th
 }
 
 void ThreadsSMRSupport::add_thread(JavaThread *thread){
+  elapsedTimer timer;
+  if (EnableThreadSMRStatistics) {
+    timer.start();
+  }
+
   ThreadsList *new_list = ThreadsList::add_thread(get_java_thread_list(), thread);
   if (EnableThreadSMRStatistics) {
     inc_java_thread_list_alloc_cnt();
@@ -864,6 +886,10 @@ void ThreadsSMRSupport::add_thread(JavaThread *thread){
 
   ThreadsList *old_list = xchg_java_thread_list(new_list);
   free_list(old_list);
+  if (EnableThreadSMRStatistics) {
+    timer.stop();
+    update_java_thread_list_update_time(timer);
+  }
   if (ThreadIdTable::is_initialized()) {
     jlong tid = SharedRuntime::get_java_tid(thread);
     ThreadIdTable::add_thread(tid, thread);
@@ -1017,6 +1043,11 @@ void ThreadsSMRSupport::release_stable_list_wake_up(bool is_nested) {
 }
 
 void ThreadsSMRSupport::remove_thread(JavaThread *thread) {
+  elapsedTimer timer;
+  if (EnableThreadSMRStatistics) {
+    timer.start();
+  }
+
   ThreadsList *new_list = ThreadsList::remove_thread(ThreadsSMRSupport::get_java_thread_list(), thread);
   if (EnableThreadSMRStatistics) {
     ThreadsSMRSupport::inc_java_thread_list_alloc_cnt();
@@ -1028,6 +1059,10 @@ void ThreadsSMRSupport::remove_thread(JavaThread *thread) {
 
   ThreadsList *old_list = ThreadsSMRSupport::xchg_java_thread_list(new_list);
   ThreadsSMRSupport::free_list(old_list);
+  if (EnableThreadSMRStatistics) {
+    timer.stop();
+    ThreadsSMRSupport::update_java_thread_list_update_time(timer);
+  }
 }
 
 // See note for clear_delete_notify().
@@ -1230,6 +1265,15 @@ void ThreadsSMRSupport::print_info_on(outputStream* st) {
                  _java_thread_list_free_cnt,
                  _java_thread_list_max,
                  _nested_thread_list_max);
+    if (_java_thread_list_alloc_cnt > 1) {
+      // The initial count covers the _bootstrap_list, which is never an update.
+      st->print_cr("_java_thread_list_update_times=" UINT64_FORMAT
+                   ", avg_java_thread_list_update_time=%0.2f"
+                   ", _java_thread_list_update_time_max=%u",
+                   _java_thread_list_update_times,
+                   ((double) _java_thread_list_update_times / (_java_thread_list_alloc_cnt - 1)),
+                   _java_thread_list_update_time_max);
+    }
     if (_tlh_cnt > 0) {
       st->print_cr("_tlh_cnt=%u"
                    ", _tlh_times=%u"
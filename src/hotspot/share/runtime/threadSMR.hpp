@@ -114,6 +114,8 @@ class ThreadsSMRSupport : AllStatic {
   static uint64_t              _java_thread_list_alloc_cnt;
   static uint64_t              _java_thread_list_free_cnt;
   static uint                  _java_thread_list_max;
+  static uint                  _java_thread_list_update_time_max;
+  static uint64_t              _java_thread_list_update_times;
   static uint                  _nested_thread_list_max;
   static volatile uint         _tlh_cnt;
   static volatile uint         _tlh_time_max;
@@ -136,6 +138,7 @@ class ThreadsSMRSupport : AllStatic {
   static void threads_do(ThreadClosure *tc, ThreadsList *list);
   static void update_deleted_thread_time_max(uint new_value);
   static void update_java_thread_list_max(uint new_value);
+  static void update_java_thread_list_update_time(const elapsedTimer& timer);
   static void update_tlh_time_max(uint new_value);
   static ThreadsList* xchg_java_thread_list(ThreadsList* new_list);
 
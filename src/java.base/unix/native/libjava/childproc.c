@@ -32,6 +32,10 @@
 #include <unistd.h>
 #include <limits.h>
 
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+
 #include "childproc.h"
 #include "jni_util.h"
 
@@ -73,6 +77,14 @@ closeDescriptors(void)
     struct dirent *dirp;
     int from_fd = FAIL_FILENO + 1;
 
+#if defined(__linux__) && defined(SYS_close_range)
+    /* close_range(2) (Linux 5.9+) closes all descriptors above FAIL_FILENO
+     * in one system call, without scanning /proc/self/fd. Fall back to the
+     * scan if the kernel does not support it. */
+    if (syscall(SYS_close_range, from_fd, ~0U, 0) == 0)
+        return 1;
+#endif
+
     /* We're trying to close all file descriptors, but opendir() might
      * itself be implemented using a file descriptor, and we certainly
      * don't want to close that while it's in use.  We assume that if
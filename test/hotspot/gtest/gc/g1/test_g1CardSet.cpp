@@ -32,6 +32,7 @@
 #include "logging/log.hpp"
 #include "memory/allocation.hpp"
 #include "unittest.hpp"
+#include "utilities/autoRestore.hpp"
 #include "utilities/powerOfTwo.hpp"
 
 class G1CardSetTest : public ::testing::Test {
@@ -78,6 +79,7 @@ class G1CardSetTest : public ::testing::Test {
 
   static void cardset_basic_test();
   static void cardset_mt_test();
+  static void cardset_popular_test();
 
   static void add_cards(G1CardSet* card_set, uint cards_per_region, uint* cards, uint num_cards, G1AddCardResult* results);
   static void contains_cards(G1CardSet* card_set, uint cards_per_region, uint* cards, uint num_cards);
@@ -422,6 +424,55 @@ class G1CardSetMtTestTask : public WorkerTask {
   size_t found() const { return _found; }
 };
 
+void G1CardSetTest::cardset_popular_test() {
+  const uint CardsPerRegion = 2048;
+  const uint MaxCardsInArray = 16;
+
+  AutoSaveRestore<uint> FLAG_GUARD(G1RemSetPopularCoarsenThreshold);
+  G1RemSetPopularCoarsenThreshold = 1;
+
+  G1CardSetConfiguration config(MaxCardsInArray,
+                                0.9 /* cards_in_bitmap_threshold_percent */,
+                                8,
+                                0.8 /* cards_in_howl_threshold_percent */,
+                                CardsPerRegion,
+                                0);
+  G1CardSetFreePool free_pool(config.num_mem_object_types());
+  G1CardSetMemoryManager mm(&config, &free_pool);
+
+  G1CardSet card_set(&config, &mm);
+  ASSERT_FALSE(card_set.is_popular());
+
+  // Overflow an Array of Cards container; the card set becomes popular.
+  uint cards1[MaxCardsInArray + 1];
+  for (uint i = 0; i < ARRAY_SIZE(cards1); i++) {
+    cards1[i] = i * 3;
+    card_set.add_card(1, cards1[i]);
+  }
+  ASSERT_TRUE(card_set.is_popular());
+  ASSERT_EQ(card_set.num_inline_ptr_to_howl_coarsenings(), 0u);
+
+  // The next card region overflowing its Inline Ptr container skips Array of Cards.
+  const uint NumCards2 = config.max_cards_in_inline_ptr() + 1;
+  for (uint i = 0; i < NumCards2; i++) {
+    card_set.add_card(2, i * 5);
+  }
+  ASSERT_EQ(card_set.num_inline_ptr_to_howl_coarsenings(), 1u);
+
+  for (uint i = 0; i < ARRAY_SIZE(cards1); i++) {
+    ASSERT_TRUE(card_set.contains_card(1, cards1[i]));
+  }
+  for (uint i = 0; i < NumCards2; i++) {
+    ASSERT_TRUE(card_set.contains_card(2, i * 5));
+  }
+  ASSERT_EQ(card_set.occupied(), ARRAY_SIZE(cards1) + NumCards2);
+  check_iteration(&card_set, card_set.occupied());
+
+  card_set.clear();
+  ASSERT_FALSE(card_set.is_popular());
+  ASSERT_EQ(card_set.num_inline_ptr_to_howl_coarsenings(), 0u);
+}
+
 void G1CardSetTest::cardset_mt_test() {
   const uint CardsPerRegion = 16384;
   const double FullCardSetThreshold = 1.0;
@@ -486,3 +537,7 @@ TEST_VM(G1CardSetTest, basic_cardset_test) {
 TEST_VM(G1CardSetTest, mt_cardset_test) {
   G1CardSetTest::cardset_mt_test();
 }
+
+TEST_VM(G1CardSetTest, popular_cardset_test) {
+  G1CardSetTest::cardset_popular_test();
+}
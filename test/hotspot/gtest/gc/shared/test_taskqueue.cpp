@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+#include "precompiled.hpp"
+#include "gc/shared/taskqueue.inline.hpp"
+#include "runtime/globals.hpp"
+#include "utilities/autoRestore.hpp"
+#include "unittest.hpp"
+
+typedef GenericTaskQueue<int, mtGC, 16> TestTaskQueue;
+typedef GenericTaskQueueSet<TestTaskQueue, mtGC> TestTaskQueueSet;
+
+class TaskQueueStealTest : public ::testing::Test {
+protected:
+  static const uint NumQueues = 4;
+
+  TestTaskQueue* _queues[NumQueues];
+  TestTaskQueueSet _set;
+
+  TaskQueueStealTest() : _set(NumQueues) {
+    for (uint i = 0; i < NumQueues; i++) {
+      _queues[i] = new TestTaskQueue();
+      _set.register_queue(i, _queues[i]);
+    }
+  }
+
+  ~TaskQueueStealTest() {
+    for (uint i = 0; i < NumQueues; i++) {
+      delete _queues[i];
+    }
+  }
+
+  void set_nodes(int n0, int n1, int n2, int n3) {
+    _queues[0]->set_numa_node(n0);
+    _queues[1]->set_numa_node(n1);
+    _queues[2]->set_numa_node(n2);
+    _queues[3]->set_numa_node(n3);
+  }
+
+  // Push count elements tagged with the queue index onto queue i.
+  void fill(uint i, uint count) {
+    for (uint j = 0; j < count; j++) {
+      ASSERT_TRUE(_queues[i]->push((int)(i * 100 + j)));
+    }
+  }
+
+#if TASKQUEUE_STATS
+  size_t stat(uint i, TaskQueueStats::StatId id) const {
+    return _queues[i]->stats.get(id);
+  }
+
+  // The invariants checked by TaskQueueStats::verify(), which only exists in
+  // debug builds.
+  void check_stats(uint i) const {
+    EXPECT_LE(stat(i, TaskQueueStats::steal_local), stat(i, TaskQueueStats::steal_success));
+    EXPECT_LE(stat(i, TaskQueueStats::steal_success), stat(i, TaskQueueStats::steal_attempt));
+    EXPECT_EQ(stat(i, TaskQueueStats::steal_empty) +
+              stat(i, TaskQueueStats::steal_contended) +
+              stat(i, TaskQueueStats::steal_success),
+              stat(i, TaskQueueStats::steal_attempt));
+  }
+#endif // TASKQUEUE_STATS
+};
+
+TEST_VM_F(TaskQueueStealTest, prefers_same_node_victim) {
+  AutoModifyRestore<bool> numa(UseNUMA, true);
+  set_nodes(0, 1, 0, 1);
+  fill(1, 4);
+  fill(2, 1);
+  fill(3, 4);
+
+  int t;
+  ASSERT_TRUE(_set.steal(0, t));
+  EXPECT_EQ(200, t);
+
+#if TASKQUEUE_STATS
+  EXPECT_EQ(1u, stat(0, TaskQueueStats::steal_success));
+  EXPECT_EQ(1u, stat(0, TaskQueueStats::steal_local));
+  check_stats(0);
+#endif // TASKQUEUE_STATS
+}
+
+TEST_VM_F(TaskQueueStealTest, picks_fullest_same_node_victim) {
+  AutoModifyRestore<bool> numa(UseNUMA, true);
+  set_nodes(0, 0, 0, 0);
+  fill(1, 1);
+  fill(2, 3);
+  fill(3, 2);
+
+  int t;
+  ASSERT_TRUE(_set.steal(0, t));
+  // pop_global() takes from the oldest end of the queue.
+  EXPECT_EQ(200, t);
+}
+
+TEST_VM_F(TaskQueueStealTest, falls_back_to_remote_victim) {
+  AutoModifyRestore<bool> numa(UseNUMA, true);
+  set_nodes(0, 1, 1, 1);
+  fill(1, 1);
+  fill(2, 1);
+  fill(3, 1);
+
+  int t;
+  ASSERT_TRUE(_set.steal(0, t));
+  EXPECT_EQ(0, t % 100);
+  EXPECT_NE(0, t / 100);
+
+#if TASKQUEUE_STATS
+  EXPECT_EQ(1u, stat(0, TaskQueueStats::steal_success));
+  EXPECT_EQ(0u, stat(0, TaskQueueStats::steal_local));
+  check_stats(0);
+#endif // TASKQUEUE_STATS
+}
+
+TEST_VM_F(TaskQueueStealTest, unknown_node_uses_best_of_2) {
+  AutoModifyRestore<bool> numa(UseNUMA, true);
+  set_nodes(TestTaskQueue::UnknownNumaNode, 0, 0, 0);
+  fill(1, 1);
+  fill(2, 1);
+  fill(3, 1);
+
+  int t;
+  ASSERT_TRUE(_set.steal(0, t));
+
+#if TASKQUEUE_STATS
+  EXPECT_EQ(0u, stat(0, TaskQueueStats::steal_local));
+  check_stats(0);
+#endif // TASKQUEUE_STATS
+}
+
+TEST_VM_F(TaskQueueStealTest, drains_all_queues) {
+  AutoModifyRestore<bool> numa(UseNUMA, true);
+  set_nodes(0, 0, 1, 1);
+  for (uint i = 1; i < NumQueues; i++) {
+    fill(i, 3);
+  }
+
+  // Stealing never loses or duplicates elements, whichever victim it picks.
+  bool seen[NumQueues][3] = {};
+  int t;
+  for (uint i = 0; i < (NumQueues - 1) * 3; i++) {
+    ASSERT_TRUE(_set.steal(0, t));
+    const uint q = (uint)t / 100;
+    const uint j = (uint)t % 100;
+    ASSERT_LT(q, NumQueues);
+    ASSERT_LT(j, 3u);
+    EXPECT_FALSE(seen[q][j]);
+    seen[q][j] = true;
+  }
+  EXPECT_FALSE(_set.steal(0, t));
+  EXPECT_EQ(0u, _set.tasks());
+
+#if TASKQUEUE_STATS
+  // Queue 1 is the only same-node victim; all of its elements count as local.
+  EXPECT_EQ(9u, stat(0, TaskQueueStats::steal_success));
+  EXPECT_EQ(3u, stat(0, TaskQueueStats::steal_local));
+  check_stats(0);
+#endif // TASKQUEUE_STATS
+}
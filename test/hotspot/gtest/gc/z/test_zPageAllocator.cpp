@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "gc/z/zGlobals.hpp"
+#include "gc/z/zPageAllocator.hpp"
+#include "gc/z/zPhysicalMemory.inline.hpp"
+#include "gc/z/zVirtualMemory.inline.hpp"
+#include "unittest.hpp"
+
+class ZAddressOffsetMaxSetter {
+private:
+  const size_t _old_max;
+  const size_t _old_mask;
+
+public:
+  ZAddressOffsetMaxSetter()
+    : _old_max(ZAddressOffsetMax),
+      _old_mask(ZAddressOffsetMask) {
+    ZAddressOffsetMax = size_t(16) * G * 1024;
+    ZAddressOffsetMask = ZAddressOffsetMax - 1;
+  }
+  ~ZAddressOffsetMaxSetter() {
+    ZAddressOffsetMax = _old_max;
+    ZAddressOffsetMask = _old_mask;
+  }
+};
+
+static ZPhysicalMemory pmem_at(size_t start, size_t size) {
+  ZPhysicalMemory pmem;
+  pmem.add_segment(ZPhysicalMemorySegment(zoffset(start), size, true));
+  return pmem;
+}
+
+TEST(ZPageAllocatorTest, mergeable_contiguous) {
+  ZAddressOffsetMaxSetter setter;
+
+  const ZVirtualMemory vmem0(zoffset(0), ZGranuleSize);
+  const ZVirtualMemory vmem1(zoffset(ZGranuleSize), ZGranuleSize);
+
+  // Physically adjacent
+  EXPECT_TRUE(ZPageAllocator::is_mergeable(vmem0, pmem_at(0, ZGranuleSize),
+                                           vmem1, pmem_at(ZGranuleSize, ZGranuleSize)));
+
+  // Physical gap, but still in address order
+  EXPECT_TRUE(ZPageAllocator::is_mergeable(vmem0, pmem_at(0, ZGranuleSize),
+                                           vmem1, pmem_at(4 * ZGranuleSize, ZGranuleSize)));
+}
+
+TEST(ZPageAllocatorTest, not_mergeable_virtual_gap) {
+  ZAddressOffsetMaxSetter setter;
+
+  const ZVirtualMemory vmem0(zoffset(0), ZGranuleSize);
+  const ZVirtualMemory vmem1(zoffset(2 * ZGranuleSize), ZGranuleSize);
+
+  EXPECT_FALSE(ZPageAllocator::is_mergeable(vmem0, pmem_at(0, ZGranuleSize),
+                                            vmem1, pmem_at(ZGranuleSize, ZGranuleSize)));
+}
+
+TEST(ZPageAllocatorTest, not_mergeable_physical_order) {
+  ZAddressOffsetMaxSetter setter;
+
+  const ZVirtualMemory vmem0(zoffset(0), ZGranuleSize);
+  const ZVirtualMemory vmem1(zoffset(ZGranuleSize), ZGranuleSize);
+
+  // Physical memory in reverse order
+  EXPECT_FALSE(ZPageAllocator::is_mergeable(vmem0, pmem_at(ZGranuleSize, ZGranuleSize),
+                                            vmem1, pmem_at(0, ZGranuleSize)));
+
+  // Last segment of the first page overlaps the second page
+  ZPhysicalMemory pmem0 = pmem_at(0, ZGranuleSize);
+  pmem0.add_segment(ZPhysicalMemorySegment(zoffset(8 * ZGranuleSize), ZGranuleSize, true));
+  const ZVirtualMemory vmem2(zoffset(0), 2 * ZGranuleSize);
+  const ZVirtualMemory vmem3(zoffset(2 * ZGranuleSize), ZGranuleSize);
+  EXPECT_FALSE(ZPageAllocator::is_mergeable(vmem2, pmem0,
+                                            vmem3, pmem_at(4 * ZGranuleSize, ZGranuleSize)));
+}
+
+TEST(ZPageAllocatorTest, split_then_merge) {
+  ZAddressOffsetMaxSetter setter;
+
+  ZVirtualMemory vmem(zoffset(0), 3 * ZGranuleSize);
+  ZPhysicalMemory pmem = pmem_at(0, ZGranuleSize);
+  pmem.add_segment(ZPhysicalMemorySegment(zoffset(10 * ZGranuleSize), 2 * ZGranuleSize, true));
+  const ZPhysicalMemory original(pmem);
+
+  // Split into three single granule parts, the same way ZPage::split does
+  ZVirtualMemory vmems[3];
+  ZPhysicalMemory pmems[3];
+  for (int i = 0; i < 2; i++) {
+    vmems[i] = vmem.split(ZGranuleSize);
+    pmems[i] = pmem.split(ZGranuleSize);
+  }
+  vmems[2] = vmem;
+  pmems[2] = pmem;
+
+  // All adjacent parts can be merged back
+  for (int i = 1; i < 3; i++) {
+    EXPECT_TRUE(ZPageAllocator::is_mergeable(vmems[i - 1], pmems[i - 1], vmems[i], pmems[i]));
+  }
+
+  // Merging sorted parts restores the original layout
+  ZPhysicalMemory merged;
+  for (int i = 0; i < 3; i++) {
+    merged.add_segments(pmems[i]);
+  }
+
+  EXPECT_EQ(merged.size(), original.size());
+  ASSERT_EQ(merged.nsegments(), original.nsegments());
+  for (int i = 0; i < merged.nsegments(); i++) {
+    EXPECT_EQ(untype(merged.segment(i).start()), untype(original.segment(i).start()));
+    EXPECT_EQ(merged.segment(i).size(), original.segment(i).size());
+  }
+
+  // Merging out of order is rejected
+  EXPECT_FALSE(ZPageAllocator::is_mergeable(vmems[1], pmems[1], vmems[0], pmems[0]));
+}
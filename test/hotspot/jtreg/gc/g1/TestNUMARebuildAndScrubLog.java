@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/*
+ * @test TestNUMARebuildAndScrubLog
+ * @summary Check that the rebuild and scrub locality of G1 is reported with -Xlog:gc+heap+numa.
+ * @requires vm.gc.G1
+ * @requires vm.flagless
+ * @library /test/lib
+ * @build jdk.test.whitebox.WhiteBox
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller jdk.test.whitebox.WhiteBox
+ * @run driver gc.g1.TestNUMARebuildAndScrubLog
+ */
+
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+import jdk.test.whitebox.WhiteBox;
+
+import jtreg.SkippedException;
+
+public class TestNUMARebuildAndScrubLog {
+    // Printed with every GC whenever G1 keeps NUMA statistics.
+    static final String PLACEMENT_LINE = "Placement match ratio: ";
+    static final String REBUILD_LINE = "Rebuild and scrub locality match ratio: ";
+    static final Pattern REBUILD_TOTAL = Pattern.compile(REBUILD_LINE + "\\d+% \\d+/(\\d+) ");
+
+    public static void main(String[] args) throws Exception {
+        OutputAnalyzer output = ProcessTools.executeTestJava("-Xbootclasspath/a:.",
+                                                             "-XX:+UseG1GC",
+                                                             "-XX:+UseNUMA",
+                                                             "-XX:+UnlockDiagnosticVMOptions",
+                                                             "-XX:+WhiteBoxAPI",
+                                                             "-Xlog:gc+heap+numa=info",
+                                                             "-Xms64M",
+                                                             "-Xmx64M",
+                                                             GCTest.class.getName());
+        output.shouldHaveExitValue(0);
+
+        if (!output.getStdout().contains(PLACEMENT_LINE)) {
+            throw new SkippedException("G1 does not use NUMA on this machine");
+        }
+
+        // The line lists the total and the ratio for every node.
+        output.shouldMatch(REBUILD_LINE + "\\d+% \\d+/\\d+ \\(\\d+: \\d+% \\d+/\\d+(, \\d+: \\d+% \\d+/\\d+)*\\)");
+
+        // The pause after the concurrent cycle reports the regions it processed.
+        boolean processed = false;
+        for (String line : output.asLines()) {
+            Matcher m = REBUILD_TOTAL.matcher(line);
+            if (m.find() && Long.parseLong(m.group(1)) > 0) {
+                processed = true;
+            }
+        }
+        if (!processed) {
+            throw new RuntimeException("No regions reported as processed by rebuild and scrub");
+        }
+    }
+
+    public static class GCTest {
+        public static void main(String args[]) throws Exception {
+            WhiteBox wb = WhiteBox.getWhiteBox();
+            // Promote some objects to the old generation so that there are old
+            // regions for the rebuild and scrub to process.
+            Object[] used = new Object[1024];
+            for (int i = 0; i < used.length; i++) {
+                used[i] = new byte[1024];
+            }
+            wb.fullGC();
+
+            wb.g1RunConcurrentGC();
+            // The statistics gathered during the concurrent cycle are printed
+            // at the end of the next pause.
+            wb.youngGC();
+            System.out.println(used.length);
+        }
+    }
+}
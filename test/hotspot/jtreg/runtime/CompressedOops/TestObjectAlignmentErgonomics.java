@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Check that UseObjectAlignmentErgonomics raises ObjectAlignmentInBytes
+ *          to keep compressed oops for heaps between 32G and 64G
+ * @requires vm.bits == 64
+ * @requires vm.gc.Serial
+ * @requires vm.cds
+ * @requires vm.flagless
+ * @library /test/lib
+ * @run driver TestObjectAlignmentErgonomics
+ */
+
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestObjectAlignmentErgonomics {
+    static final String COOPS_LINE = "Using ObjectAlignmentInBytes=16 to keep compressed oops";
+    static final String CDS_LINE = "CDS archives created with ObjectAlignmentInBytes=8";
+
+    static OutputAnalyzer run(String... extraArgs) throws Exception {
+        List<String> args = new ArrayList<>(Arrays.asList(
+            "-XX:+UseSerialGC",
+            "-XX:+UnlockExperimentalVMOptions",
+            "-Xlog:gc+heap+coops=info,cds=info",
+            "-XX:+PrintFlagsFinal"));
+        args.addAll(Arrays.asList(extraArgs));
+        args.add("-version");
+        OutputAnalyzer output = ProcessTools.executeTestJava(args.toArray(new String[0]));
+        output.shouldHaveExitValue(0);
+        return output;
+    }
+
+    static void check(OutputAnalyzer output, int alignment, boolean compressedOops, boolean ergonomic) {
+        output.shouldMatch("int ObjectAlignmentInBytes\\s+= " + alignment + "\\s");
+        output.shouldMatch("bool UseCompressedOops\\s+= " + compressedOops + "\\s");
+        if (ergonomic) {
+            output.shouldContain(COOPS_LINE);
+            output.shouldContain(CDS_LINE);
+        } else {
+            output.shouldNotContain(COOPS_LINE);
+            output.shouldNotContain(CDS_LINE);
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        // Between the limits for 8- and 16-byte alignment the ergonomics
+        // keep compressed oops.
+        check(run("-Xmx40g", "-XX:+UseObjectAlignmentErgonomics"), 16, true, true);
+
+        // The ergonomics are off by default.
+        check(run("-Xmx40g"), 8, false, false);
+        check(run("-Xmx40g", "-XX:-UseObjectAlignmentErgonomics"), 8, false, false);
+
+        // An explicitly set alignment is kept.
+        check(run("-Xmx40g", "-XX:+UseObjectAlignmentErgonomics", "-XX:ObjectAlignmentInBytes=8"), 8, false, false);
+        check(run("-Xmx40g", "-XX:+UseObjectAlignmentErgonomics", "-XX:ObjectAlignmentInBytes=16"), 16, true, false);
+
+        // An explicitly set UseCompressedOops disables the ergonomics.
+        check(run("-Xmx40g", "-XX:+UseObjectAlignmentErgonomics", "-XX:-UseCompressedOops"), 8, false, false);
+        OutputAnalyzer output = run("-Xmx40g", "-XX:+UseObjectAlignmentErgonomics", "-XX:+UseCompressedOops");
+        check(output, 8, false, false);
+        output.shouldContain("Max heap size too large for Compressed Oops");
+
+        // Heaps that fit with 8-byte alignment are not affected.
+        check(run("-Xmx16g", "-XX:+UseObjectAlignmentErgonomics"), 8, true, false);
+
+        // Heaps that do not fit with 16-byte alignment either keep 8-byte
+        // alignment and run without compressed oops.
+        check(run("-Xmx80g", "-XX:+UseObjectAlignmentErgonomics"), 8, false, false);
+    }
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Check that MADV_COLLAPSE after pretouch is reported with -Xlog:pagesize
+ * @requires os.family == "linux"
+ * @requires vm.gc.G1
+ * @requires vm.flagless
+ * @library /test/lib
+ * @run driver TestTHPCollapseAfterPretouch
+ */
+
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+import jtreg.SkippedException;
+
+public class TestTHPCollapseAfterPretouch {
+    static final String COLLAPSE_LINE = "G1 PreTouch: Transparent huge page collapse: ";
+
+    static OutputAnalyzer run(String... extraArgs) throws Exception {
+        List<String> args = new ArrayList<>(Arrays.asList(
+            "-XX:+UseG1GC",
+            "-Xms64m", "-Xmx64m",
+            "-XX:+AlwaysPreTouch",
+            "-XX:+UseTransparentHugePages",
+            "-Xlog:pagesize=debug",
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:+PrintFlagsFinal"));
+        args.addAll(Arrays.asList(extraArgs));
+        args.add("-version");
+        OutputAnalyzer output = ProcessTools.executeTestJava(args.toArray(new String[0]));
+        output.shouldHaveExitValue(0);
+        return output;
+    }
+
+    static boolean flagIsTrue(OutputAnalyzer output, String flag) {
+        return output.firstMatch("bool " + flag + "\\s+= true") != null;
+    }
+
+    public static void main(String[] args) throws Exception {
+        OutputAnalyzer output = run();
+        if (!flagIsTrue(output, "UseTransparentHugePages")) {
+            throw new SkippedException("Transparent huge pages are not available");
+        }
+
+        if (flagIsTrue(output, "UseMadvCollapse") && flagIsTrue(output, "UseMadvPopulateWrite")) {
+            // One line per pretouch task, reporting that task's own coverage.
+            output.shouldMatch(COLLAPSE_LINE + "\\d+[BKMG] of \\d+[BKMG] collapsed \\(\\d+\\.\\d%\\)");
+        } else {
+            output.shouldNotContain(COLLAPSE_LINE);
+        }
+
+        // Nothing is reported if the collapse is disabled.
+        output = run("-XX:-UseMadvCollapse");
+        output.shouldNotContain(COLLAPSE_LINE);
+
+        // Nothing is reported without pretouch.
+        output = run("-XX:-AlwaysPreTouch");
+        output.shouldNotContain(COLLAPSE_LINE);
+    }
+}